@@ -58,6 +58,7 @@
 // include all the library headers, so a sketch can use a single
 // #include <Audio.h> to get the whole library
 //
+#include "event_queue.h"
 #include "analyze_fft256.h"
 #include "analyze_fft1024.h"
 #include "analyze_print.h"
@@ -76,22 +77,32 @@
 #include "effect_chorus.h"
 #include "effect_fade.h"
 #include "effect_flange.h"
+#include "effect_ensemble.h"
 #include "effect_envelope.h"
+#include "effect_envelope_exp.h"
 #include "effect_multiply.h"
 #include "effect_delay.h"
 #include "effect_delay_ext.h"
+#include "effect_delay_mod.h"
 #include "effect_midside.h"
 #include "effect_reverb.h"
 #include "effect_freeverb.h"
+#include "effect_reverb_fdn.h"
 #include "effect_waveshaper.h"
 #include "effect_granular.h"
+#include "effect_granular_cloud.h"
+#include "effect_pitchshift.h"
 #include "effect_combine.h"
 #include "effect_rectifier.h"
 #include "effect_wavefolder.h"
+#include "effect_vocoder.h"
+#include "effect_dynamics.h"
 #include "filter_biquad.h"
 #include "filter_fir.h"
 #include "filter_variable.h"
 #include "filter_ladder.h"
+#include "filter_crossover.h"
+#include "filter_equalizer.h"
 #include "input_adc.h"
 #include "input_adcs.h"
 #include "input_i2s.h"
@@ -131,12 +142,21 @@
 #include "synth_tonesweep.h"
 #include "synth_sine.h"
 #include "synth_waveform.h"
+#include "synth_waveform_morph.h"
+#include "synth_waveform_unison.h"
 #include "synth_dc.h"
 #include "synth_whitenoise.h"
 #include "synth_pinknoise.h"
+#include "synth_noise_multi.h"
 #include "synth_karplusstrong.h"
 #include "synth_simple_drum.h"
+#include "synth_drum_machine.h"
+#include "synth_additive.h"
+#include "synth_fm.h"
+#include "synth_string_bank.h"
 #include "synth_pwm.h"
 #include "synth_wavetable.h"
+#include "synth_wavetable_poly.h"
+#include "synth_wavetable_stream.h"
 
 #endif
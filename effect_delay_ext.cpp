@@ -53,7 +53,12 @@
 void AudioEffectDelayExternal::update(void)
 {
 	audio_block_t *block;
-	uint32_t n, channel, read_offset;
+	uint32_t n, channel;
+
+	if (dma && !stopping) {
+		updatePipelined();
+		return;
+	}
 
 	// grab incoming data and put it into the memory
 	block = receiveReadOnly();
@@ -62,6 +67,7 @@ void AudioEffectDelayExternal::update(void)
 		release(block);
 		return;
 	}
+	while (chain_last) ; // wait for pipelined delays to finish using SPI
 	if (block) {
 		if (head_offset + AUDIO_BLOCK_SAMPLES <= memory_length) {
 			// a single write is enough
@@ -90,31 +96,330 @@ void AudioEffectDelayExternal::update(void)
 	}
 
 	// transmit the delayed outputs
+	audio_block_t *out[8];
+	uint32_t mask = 0;
 	for (channel = 0; channel < 8; channel++) {
+		out[channel] = NULL;
 		if (!(activemask & (1<<channel))) continue;
-		block = allocate();
-		if (!block) continue;
-		// compute the delayed location where we read
-		if (delay_length[channel] <= head_offset) {
-			read_offset = head_offset - delay_length[channel];
-		} else {
-			read_offset = memory_length + head_offset - delay_length[channel];
+		out[channel] = allocate();
+		if (out[channel]) mask |= (1<<channel);
+	}
+	segment_t seg[16];
+	uint32_t count = planReads(seg, mask, 0);
+	for (uint32_t i = 0; i < count; ) {
+		uint32_t end;
+		n = burst(seg, i, count, &end);
+		read(seg[i].offset, end - seg[i].offset, seg + i, n - i, out);
+		i = n;
+	}
+	for (channel = 0; channel < 8; channel++) {
+		if (!out[channel]) continue;
+		transmit(out[channel], channel);
+		release(out[channel]);
+	}
+}
+
+// Find the memory to read for each tap.  The tap's block is split where
+// it wraps across end-of-memory, and all the pieces are sorted in order
+// of address.  When the outputs will be transmitted later, latency
+// samples are subtracted from each delay, but the newest data which can
+// be read is the most recently written block.
+uint32_t AudioEffectDelayExternal::planReads(segment_t *seg, uint32_t mask, uint32_t latency)
+{
+	uint32_t channel, count = 0;
+
+	for (channel = 0; channel < 8; channel++) {
+		if (!(mask & (1<<channel))) continue;
+		uint32_t d = AUDIO_BLOCK_SAMPLES;
+		if (delay_length[channel] >= latency + AUDIO_BLOCK_SAMPLES) {
+			d = delay_length[channel] - latency;
 		}
-		if (read_offset + AUDIO_BLOCK_SAMPLES <= memory_length) {
-			// a single read will do it
-			read(read_offset, AUDIO_BLOCK_SAMPLES, block->data);
+		uint32_t offset;
+		if (d <= head_offset) {
+			offset = head_offset - d;
 		} else {
+			offset = memory_length + head_offset - d;
+		}
+		uint32_t n = AUDIO_BLOCK_SAMPLES;
+		if (offset + AUDIO_BLOCK_SAMPLES > memory_length) {
 			// read wraps across end-of-memory
-			n = memory_length - read_offset;
-			read(read_offset, n, block->data);
-			read(0, AUDIO_BLOCK_SAMPLES - n, block->data + n);
+			n = memory_length - offset;
+			seg[count].offset = 0;
+			seg[count].count = AUDIO_BLOCK_SAMPLES - n;
+			seg[count].channel = channel;
+			seg[count].index = n;
+			count++;
+		}
+		seg[count].offset = offset;
+		seg[count].count = n;
+		seg[count].channel = channel;
+		seg[count].index = 0;
+		count++;
+	}
+	// insertion sort, at most 16 pieces
+	for (uint32_t i = 1; i < count; i++) {
+		segment_t tmp = seg[i];
+		uint32_t j = i;
+		while (j > 0 && seg[j-1].offset > tmp.offset) {
+			seg[j] = seg[j-1];
+			j--;
+		}
+		seg[j] = tmp;
+	}
+	return count;
+}
+
+// Group the sorted pieces from first which overlap, or have only a small
+// gap between them, so they can be read with a single SPI command.
+// Returns the index after the last piece in the group, and the end of
+// the memory it covers.
+uint32_t AudioEffectDelayExternal::burst(const segment_t *seg, uint32_t first, uint32_t count, uint32_t *end)
+{
+	uint32_t e = seg[first].offset + seg[first].count;
+	uint32_t i;
+
+	for (i = first + 1; i < count; i++) {
+		if (seg[i].offset > e + DELAY_EXT_BURST_GAP) break;
+		uint32_t n = seg[i].offset + seg[i].count;
+		if (n > e) e = n;
+	}
+	*end = e;
+	return i;
+}
+
+// In pipelined mode, each update transmits the outputs read by the DMA
+// transfers started in the previous update, then starts a new chain of
+// transfers: first the incoming block is written, then the taps are read
+// in bursts.  The CPU is only needed briefly between transfers.
+//
+// The data is sent as bytes rather than 16 bit words, so samples are
+// byte swapped to keep the memory contents the same as non-pipelined mode.
+void AudioEffectDelayExternal::updatePipelined(void)
+{
+	audio_block_t *block;
+	uint32_t i, n, channel;
+
+	// normally the transfers finished long ago, but if not, they must
+	while (chain_busy) ;
+#if defined(__IMXRT1062__)
+	arm_dcache_delete(dma->rx, sizeof(dma->rx));
+#endif
+
+	// transmit the outputs read during the last update period
+	audio_block_t *out[8];
+	for (channel = 0; channel < 8; channel++) {
+		out[channel] = NULL;
+		if (pending_mask & (1<<channel)) out[channel] = allocate();
+	}
+	for (i = 0; i < dma->segment_count; i++) {
+		const segment_t *sp = dma->segments + i;
+		block = out[sp->channel];
+		if (!block) continue;
+		const int16_t *src = dma->rx + sp->rx;
+		int16_t *dst = block->data + sp->index;
+		for (n = 0; n < sp->count; n++) {
+			dst[n] = (int16_t)__builtin_bswap16(src[n]);
+		}
+	}
+	for (channel = 0; channel < 8; channel++) {
+		if (!out[channel]) continue;
+		transmit(out[channel], channel);
+		release(out[channel]);
+	}
+	pending_mask = 0;
+	op_count = 0;
+
+	// queue writing the incoming data
+	int16_t *tx = NULL;
+	block = receiveReadOnly();
+	if (block) {
+		tx = dma->tx;
+		for (n = 0; n < AUDIO_BLOCK_SAMPLES; n++) {
+			tx[n] = (int16_t)__builtin_bswap16(block->data[n]);
 		}
-		transmit(block, channel);
 		release(block);
 	}
+	if (head_offset + AUDIO_BLOCK_SAMPLES <= memory_length) {
+		queue(0x02, head_offset, AUDIO_BLOCK_SAMPLES, tx);
+		head_offset += AUDIO_BLOCK_SAMPLES;
+	} else {
+		n = memory_length - head_offset;
+		queue(0x02, head_offset, n, tx);
+		head_offset = AUDIO_BLOCK_SAMPLES - n;
+		queue(0x02, 0, head_offset, tx ? tx + n : NULL);
+	}
+
+	// queue reading the taps, one block closer to the head because
+	// they will not be transmitted until the next update.  Each burst
+	// is read into the next free part of the receive buffer.
+	segment_t *seg = dma->segments;
+	uint32_t count = planReads(seg, activemask, AUDIO_BLOCK_SAMPLES);
+	uint32_t rx = 0;
+	for (i = 0; i < count; ) {
+		uint32_t end, start = seg[i].offset;
+		n = burst(seg, i, count, &end);
+		queue(0x03, start, end - start, dma->rx + rx);
+		for ( ; i < n; i++) {
+			seg[i].rx = rx + seg[i].offset - start;
+		}
+		rx += end - start;
+	}
+	dma->segment_count = count;
+	pending_mask = activemask;
+
+	// start the transfers, which continue in the background, or wait
+	// for the transfers of other delays using the SPI port to finish
+	op_index = 0;
+	chain_busy = true;
+	next_chain = NULL;
+	__disable_irq();
+	if (chain_last) {
+		chain_last->next_chain = this;
+		chain_last = this;
+		__enable_irq();
+		return;
+	}
+	chain_last = this;
+	__enable_irq();
+	SPI.beginTransaction(SPISETTING);
+	startTransfer();
+}
+
+// add a read or write to the chain, split at chip boundaries
+void AudioEffectDelayExternal::queue(uint8_t command, uint32_t offset, uint32_t count, int16_t *data)
+{
+	uint32_t addr = memory_begin + offset;
+
+	while (count) {
+		uint32_t num = count;
+		if (memory_type == AUDIO_MEMORY_MEMORYBOARD) {
+			uint32_t avail = 0x10000 - (addr & 0xFFFF);
+			if (num > avail) num = avail;
+		} else if (memory_type == AUDIO_MEMORY_CY15B104 && command == 0x02) {
+			spi_op_t *op = dma->ops + op_count++;
+			op->address = addr;
+			op->data = NULL;
+			op->count = 0;
+			op->command = 0x06; // write-enable before every write
+		}
+		spi_op_t *op = dma->ops + op_count++;
+		op->address = addr;
+		op->data = data;
+		op->count = num;
+		op->command = command;
+		addr += num;
+		count -= num;
+		if (data) data += num;
+	}
+}
+
+// select the chip and send the command and address for the current op
+void AudioEffectDelayExternal::startTransfer(void)
+{
+	const spi_op_t *op = dma->ops + op_index;
+	uint8_t *header = dma->header;
+	uint32_t addr;
+
+	if (memory_type == AUDIO_MEMORY_MEMORYBOARD) {
+		uint32_t chip = (op->address >> 16) + 1;
+		digitalWriteFast(MEMBOARD_CS0_PIN, chip & 1);
+		digitalWriteFast(MEMBOARD_CS1_PIN, chip & 2);
+		digitalWriteFast(MEMBOARD_CS2_PIN, chip & 4);
+		addr = (op->address & 0xFFFF) << 1;
+	} else {
+		digitalWriteFast(SPIRAM_CS_PIN, LOW);
+		addr = op->address << 1;
+	}
+	header[0] = op->command;
+	header[1] = addr >> 16;
+	header[2] = addr >> 8;
+	header[3] = addr;
+	op_phase = 0;
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	SPI.transfer(header, NULL, (op->command == 0x06) ? 1 : 4, event);
+#endif
+}
+
+// called from the SPI DMA interrupt as each transfer completes
+void AudioEffectDelayExternal::transferEvent(EventResponderRef event)
+{
+	AudioEffectDelayExternal *p = (AudioEffectDelayExternal *)event.getContext();
+	const spi_op_t *op = p->dma->ops + p->op_index;
+
+	if (p->op_phase == 0 && op->count > 0) {
+		// command and address sent, now the data
+		p->op_phase = 1;
+		const void *tx = (op->command == 0x02) ? op->data : NULL;
+		void *rx = (op->command == 0x03) ? op->data : NULL;
+#ifdef SPI_HAS_TRANSFER_ASYNC
+		SPI.transfer(tx, rx, op->count * 2, event);
+#endif
+		return;
+	}
+	if (p->memory_type == AUDIO_MEMORY_MEMORYBOARD) {
+		digitalWriteFast(MEMBOARD_CS0_PIN, LOW);
+		digitalWriteFast(MEMBOARD_CS1_PIN, LOW);
+		digitalWriteFast(MEMBOARD_CS2_PIN, LOW);
+	} else {
+		digitalWriteFast(SPIRAM_CS_PIN, HIGH);
+	}
+	if (++p->op_index < p->op_count) {
+		p->startTransfer();
+		return;
+	}
+	SPI.endTransaction();
+	__disable_irq();
+	AudioEffectDelayExternal *next = p->next_chain;
+	if (!next) chain_last = NULL;
+	p->chain_busy = false;
+	__enable_irq();
+	if (next) {
+		SPI.beginTransaction(SPISETTING);
+		next->startTransfer();
+	}
+}
+
+void AudioEffectDelayExternal::pipeline(bool enable)
+{
+#if defined(SPI_HAS_TRANSFER_ASYNC) && !defined(INTERNAL_TEST)
+	if (memory_type >= AUDIO_MEMORY_UNDEFINED) return;
+	if (enable) {
+		if (dma) return;
+		// the buffers must be aligned to cache rows on Teensy 4
+		void *p = malloc(sizeof(dma_buffer_t) + 31);
+		if (!p) return;
+		dma_alloc = p;
+		event.setContext(this);
+		event.attachImmediate(transferEvent);
+		dma_buffer_t *buf = (dma_buffer_t *)(((uintptr_t)p + 31) & ~(uintptr_t)31);
+		buf->segment_count = 0;
+		__disable_irq();
+		pending_mask = 0;
+		dma = buf;
+		__enable_irq();
+	} else {
+		if (!dma) return;
+		// update() starts no more transfers, and uses the ordinary
+		// reads and writes, which wait for any chain still running.
+		// An update already starting a chain finishes before this
+		// continues, because update() interrupts this code.
+		stopping = true;
+		// the interrupt clears chain_busy as it takes this object out
+		// of the chain, so after this neither transferEvent() nor
+		// another delay's chain can reach the buffer
+		while (chain_busy || chain_last == this) ;
+		__disable_irq();
+		dma = NULL;
+		stopping = false;
+		__enable_irq();
+		free(dma_alloc);
+		dma_alloc = NULL;
+	}
+#endif
 }
 
 uint32_t AudioEffectDelayExternal::allocated[2] = {0, 0};
+AudioEffectDelayExternal * volatile AudioEffectDelayExternal::chain_last = NULL;
 
 void AudioEffectDelayExternal::initialize(AudioEffectDelayMemoryType_t type, uint32_t samples)
 {
@@ -123,6 +428,11 @@ void AudioEffectDelayExternal::initialize(AudioEffectDelayMemoryType_t type, uin
 	activemask = 0;
 	head_offset = 0;
 	memory_type = type;
+	dma = NULL;
+	dma_alloc = NULL;
+	chain_busy = false;
+	stopping = false;
+	pending_mask = 0;
 
 	SPI.setMOSI(SPIRAM_MOSI_PIN);
 	SPI.setMISO(SPIRAM_MISO_PIN);
@@ -176,12 +486,25 @@ void AudioEffectDelayExternal::initialize(AudioEffectDelayMemoryType_t type, uin
 static int16_t testmem[8000]; // testing only
 #endif
 
-void AudioEffectDelayExternal::read(uint32_t offset, uint32_t count, int16_t *data)
+// store one sample read from memory into every tap which uses it
+inline void AudioEffectDelayExternal::distribute(int16_t val, uint32_t offset,
+	const segment_t *seg, uint32_t nseg, audio_block_t **out)
+{
+	do {
+		uint32_t n = offset - seg->offset;
+		if (n < seg->count) out[seg->channel]->data[seg->index + n] = val;
+		seg++;
+	} while (--nseg > 0);
+}
+
+// read count samples as one burst, for the taps described by seg
+void AudioEffectDelayExternal::read(uint32_t offset, uint32_t count,
+	const segment_t *seg, uint32_t nseg, audio_block_t **out)
 {
 	uint32_t addr = memory_begin + offset;
 
 #ifdef INTERNAL_TEST
-	while (count) { *data++ = testmem[addr++]; count--; } // testing only
+	while (count) { distribute(testmem[addr++], offset++, seg, nseg, out); count--; } // testing only
 #else
 	if (memory_type == AUDIO_MEMORY_23LC1024 || 
 		memory_type == AUDIO_MEMORY_CY15B104) {
@@ -191,7 +514,7 @@ void AudioEffectDelayExternal::read(uint32_t offset, uint32_t count, int16_t *da
 		SPI.transfer16((0x03 << 8) | (addr >> 16));
 		SPI.transfer16(addr & 0xFFFF);
 		while (count) {
-			*data++ = (int16_t)(SPI.transfer16(0));
+			distribute((int16_t)(SPI.transfer16(0)), offset++, seg, nseg, out);
 			count--;
 		}
 		digitalWriteFast(SPIRAM_CS_PIN, HIGH);
@@ -211,7 +534,7 @@ void AudioEffectDelayExternal::read(uint32_t offset, uint32_t count, int16_t *da
 			count -= num;
 			addr += num;
 			do {
-				*data++ = (int16_t)(SPI.transfer16(0));
+				distribute((int16_t)(SPI.transfer16(0)), offset++, seg, nseg, out);
 			} while (--num > 0);
 		}
 		digitalWriteFast(MEMBOARD_CS0_PIN, LOW);
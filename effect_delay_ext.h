@@ -37,6 +37,13 @@ enum AudioEffectDelayMemoryType_t {
 	AUDIO_MEMORY_UNDEFINED = 3
 };
 
+// Taps which read memory with gaps of up to this many samples between
+// them are read together.  A new SPI command costs 4 bytes of command and
+// address, 2 samples, plus the chip select and setup time, so reading
+// through a gap of a few samples is about as quick.
+#define DELAY_EXT_BURST_GAP  4
+#define DELAY_EXT_RX_SIZE    (8 * AUDIO_BLOCK_SAMPLES + 15 * DELAY_EXT_BURST_GAP)
+
 class AudioEffectDelayExternal : public AudioStream
 {
 public:
@@ -67,10 +74,43 @@ public:
 		activemask = mask;
 		if (mask == 0) AudioStopUsingSPI();
 	}
+	// Move all the SPI transfers for each update to a chain of DMA
+	// transfers, which run in the background until the next update.
+	// The outputs are delivered one update later, which is compensated
+	// for all delays of at least one audio block (2.9 ms).
+	//
+	// The SPI port is then in use after update() returns, and the SPI
+	// library has no lock to keep other devices off it.  Nothing else may
+	// use the same SPI port from an audio update, such as AudioPlaySdWav
+	// or AudioPlaySerialflashRaw reading from the audio shield's SD card
+	// or flash chip, unless the memory is on its own SPI port.  From
+	// loop(), access other devices on that port this way:
+	//   AudioNoInterrupts();
+	//   while (AudioEffectDelayExternal::spiBusy()) ;
+	//   ... SD or SerialFlash access ...
+	//   AudioInterrupts();
+	void pipeline(bool enable);
+	// true while pipelined transfers are running on the SPI port
+	static bool spiBusy(void) { return chain_last != NULL; }
 	virtual void update(void);
 private:
+	// part of a tap's output block, read from one range of memory
+	struct segment_t {
+		uint32_t offset;          // in samples, from memory_begin
+		uint16_t count;
+		uint16_t rx;              // pipelined: position in receive buffer
+		uint8_t  channel;
+		uint8_t  index;           // position in the output block
+	};
+	uint32_t planReads(segment_t *seg, uint32_t mask, uint32_t latency);
+	static uint32_t burst(const segment_t *seg, uint32_t first, uint32_t count, uint32_t *end);
+	static void distribute(int16_t val, uint32_t offset, const segment_t *seg, uint32_t nseg, audio_block_t **out);
 	void initialize(AudioEffectDelayMemoryType_t type, uint32_t samples);
-	void read(uint32_t address, uint32_t count, int16_t *data);
+	void updatePipelined(void);
+	void queue(uint8_t command, uint32_t offset, uint32_t count, int16_t *data);
+	void startTransfer(void);
+	static void transferEvent(EventResponderRef event);
+	void read(uint32_t address, uint32_t count, const segment_t *seg, uint32_t nseg, audio_block_t **out);
 	void write(uint32_t address, uint32_t count, const int16_t *data);
 	void zero(uint32_t address, uint32_t count) {
 		write(address, count, NULL);
@@ -81,6 +121,34 @@ private:
 	uint32_t delay_length[8]; // # of sample delay for each channel (128 = no delay)
 	uint8_t  activemask;      // which output channels are active
 	uint8_t  memory_type;     // 0=23LC1024, 1=Frank's Memoryboard
+	// pipelined (DMA) mode
+	struct spi_op_t {
+		uint32_t address;         // in samples, including memory_begin
+		int16_t *data;            // NULL to write zeros
+		uint16_t count;           // samples
+		uint8_t  command;         // 0x02=write, 0x03=read, 0x06=write enable
+	};
+	struct dma_buffer_t {
+		uint8_t  header[32];
+		int16_t  tx[AUDIO_BLOCK_SAMPLES];
+		int16_t  rx[DELAY_EXT_RX_SIZE];
+		spi_op_t ops[40];
+		segment_t segments[16];
+		uint8_t  segment_count;
+	};
+	dma_buffer_t *dma;        // NULL when not pipelined
+	void     *dma_alloc;
+#ifdef SPI_HAS_TRANSFER_ASYNC
+	EventResponder event;
+#endif
+	volatile bool chain_busy; // DMA transfers still running
+	volatile bool stopping;   // pipeline(false) waiting for the transfers
+	uint8_t  op_count;
+	uint8_t  op_index;
+	uint8_t  op_phase;        // 0=command and address, 1=data
+	uint8_t  pending_mask;    // which rx buffers hold outputs to transmit
+	AudioEffectDelayExternal *next_chain; // waiting to use SPI after this one
+	static AudioEffectDelayExternal * volatile chain_last;
 	static uint32_t allocated[2];
 	audio_block_t *inputQueueArray[1];
 };
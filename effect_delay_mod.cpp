@@ -0,0 +1,128 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "effect_delay_mod.h"
+
+void AudioEffectDelayModulated::begin(int16_t *data, uint32_t samples)
+{
+	__disable_irq();
+	buffer = NULL;
+	__enable_irq();
+	if (!data || samples < AUDIO_BLOCK_SAMPLES + 2) return;
+	memset(data, 0, samples * sizeof(int16_t));
+	__disable_irq();
+	length = samples;
+	head = 0;
+	buffer = data;
+	__enable_irq();
+}
+
+void AudioEffectDelayModulated::update(void)
+{
+	audio_block_t *block, *mod;
+	uint32_t i, channel;
+
+	block = receiveReadOnly(0);
+	if (!buffer) {
+		if (block) release(block);
+		for (channel = 0; channel < 8; channel++) {
+			mod = receiveReadOnly(channel + 1);
+			if (mod) release(mod);
+		}
+		return;
+	}
+
+	// write the incoming data, or silence, into the memory
+	const uint32_t len = length;
+	const uint32_t start = head;
+	uint32_t n = start;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		buffer[n] = block ? block->data[i] : 0;
+		if (++n >= len) n = 0;
+	}
+	head = n;
+	if (block) release(block);
+
+	// the longest delay leaves room for the sample needed to interpolate
+	const float maxdelay = (float)(len - AUDIO_BLOCK_SAMPLES - 2);
+	for (channel = 0; channel < 8; channel++) {
+		mod = receiveReadOnly(channel + 1);
+		if (!(activemask & (1<<channel))) {
+			if (mod) release(mod);
+			continue;
+		}
+		block = allocate();
+		if (!block) {
+			if (mod) release(mod);
+			continue;
+		}
+		tap_t *t = tap + channel;
+		const float depth = mod ? t->depth : 0.0f;
+		const bool allpass = (t->interpolation == DELAY_INTERPOLATE_ALLPASS);
+		float previous = t->previous;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			float d = t->delay;
+			if (mod) d += (float)mod->data[i] * depth;
+			if (d > maxdelay) d = maxdelay;
+			float val;
+			if (allpass) {
+				// first order allpass, fractional part kept between 0.5 and
+				// 1.5 so the filter's pole stays well away from the unit circle
+				if (d < 0.5f) d = 0.5f;
+				uint32_t whole = (uint32_t)(d - 0.5f);
+				float frac = d - (float)whole;
+				float coef = (1.0f - frac) / (1.0f + frac);
+				int32_t index = (int32_t)(start + i) - (int32_t)whole;
+				if (index < 0) index += len;
+				else if (index >= (int32_t)len) index -= len;
+				int32_t index2 = index - 1;
+				if (index2 < 0) index2 += len;
+				val = (float)buffer[index2] + coef * ((float)buffer[index] - previous);
+				previous = val;
+			} else {
+				if (d < 0.0f) d = 0.0f;
+				uint32_t whole = (uint32_t)d;
+				float frac = d - (float)whole;
+				int32_t index = (int32_t)(start + i) - (int32_t)whole;
+				if (index < 0) index += len;
+				else if (index >= (int32_t)len) index -= len;
+				int32_t index2 = index - 1;
+				if (index2 < 0) index2 += len;
+				float a = buffer[index];
+				val = a + ((float)buffer[index2] - a) * frac;
+			}
+			if (val > 32767.0f) val = 32767.0f;
+			else if (val < -32768.0f) val = -32768.0f;
+			block->data[i] = (int16_t)val;
+		}
+		t->previous = previous;
+		if (mod) release(mod);
+		transmit(block, channel);
+		release(block);
+	}
+}
@@ -0,0 +1,113 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef effect_delay_mod_h_
+#define effect_delay_mod_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Delay line using memory provided by the sketch, typically a large array
+// in EXTMEM (PSRAM) on Teensy 4.1, so long delays use no audio blocks and
+// no SPI time.  Each of the 8 taps has a fractional delay, which may be
+// modulated every sample by the matching input, for tape-style wow and
+// flutter, chorus, vibrato and similar effects.
+//
+//   EXTMEM int16_t delaybuffer[441000];  // 10 seconds
+//   delay1.begin(delaybuffer, 441000);
+
+#define DELAY_INTERPOLATE_LINEAR   0
+#define DELAY_INTERPOLATE_ALLPASS  1
+
+class AudioEffectDelayModulated : public AudioStream
+{
+public:
+	AudioEffectDelayModulated(void) : AudioStream(9, inputQueueArray) {
+		buffer = NULL;
+		length = 0;
+		head = 0;
+		activemask = 0;
+		for (int i=0; i < 8; i++) {
+			tap[i].delay = 0.0f;
+			tap[i].depth = 0.0f;
+			tap[i].previous = 0.0f;
+			tap[i].interpolation = DELAY_INTERPOLATE_LINEAR;
+		}
+	}
+	// use an array of length samples as the delay memory
+	void begin(int16_t *data, uint32_t samples);
+	// delay a tap (0 to 7) by milliseconds, which need not be whole samples
+	void delay(uint8_t channel, float milliseconds) {
+		if (channel >= 8) return;
+		if (milliseconds < 0.0f) milliseconds = 0.0f;
+		float n = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+		__disable_irq();
+		tap[channel].delay = n;
+		activemask |= (1<<channel);
+		__enable_irq();
+	}
+	// full scale on the tap's modulation input changes its delay by
+	// plus or minus this many milliseconds
+	void modulation(uint8_t channel, float milliseconds) {
+		if (channel >= 8) return;
+		float n = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f) / 32768.0f;
+		__disable_irq();
+		tap[channel].depth = n;
+		__enable_irq();
+	}
+	// linear interpolation suits rapid modulation, allpass interpolation
+	// keeps the full high frequency response at fixed fractional delays
+	void interpolation(uint8_t channel, uint8_t mode) {
+		if (channel >= 8) return;
+		__disable_irq();
+		tap[channel].interpolation = mode;
+		tap[channel].previous = 0.0f;
+		__enable_irq();
+	}
+	void disable(uint8_t channel) {
+		if (channel >= 8) return;
+		__disable_irq();
+		activemask &= ~(1<<channel);
+		__enable_irq();
+	}
+	virtual void update(void);
+private:
+	struct tap_t {
+		float delay;          // samples
+		float depth;          // samples per unit of modulation input
+		float previous;       // allpass output from the prior sample
+		uint8_t interpolation;
+	};
+	tap_t tap[8];
+	int16_t *buffer;
+	uint32_t length;
+	uint32_t head;            // where the next input sample is written
+	uint8_t activemask;
+	audio_block_t *inputQueueArray[9];
+};
+
+#endif
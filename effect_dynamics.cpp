@@ -0,0 +1,326 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "effect_dynamics.h"
+#include "utility/dspinst.h"
+
+// log2(1 + i/128), Q16
+static const int32_t log2_table[129] = {
+	0, 736, 1466, 2190, 2909, 3623, 4331, 5034, 5732, 6425, 7112, 7795,
+	8473, 9146, 9814, 10477, 11136, 11791, 12440, 13086, 13727, 14363, 14996, 15624,
+	16248, 16868, 17484, 18096, 18704, 19308, 19909, 20505, 21098, 21687, 22272, 22854,
+	23433, 24007, 24579, 25146, 25711, 26272, 26830, 27384, 27936, 28484, 29029, 29571,
+	30109, 30645, 31178, 31707, 32234, 32758, 33279, 33797, 34312, 34825, 35334, 35841,
+	36346, 36847, 37346, 37842, 38336, 38827, 39316, 39802, 40286, 40767, 41246, 41722,
+	42196, 42667, 43137, 43603, 44068, 44530, 44990, 45448, 45904, 46357, 46809, 47258,
+	47705, 48150, 48593, 49034, 49472, 49909, 50344, 50776, 51207, 51636, 52063, 52488,
+	52911, 53332, 53751, 54169, 54584, 54998, 55410, 55820, 56229, 56635, 57040, 57443,
+	57845, 58245, 58643, 59039, 59434, 59827, 60219, 60609, 60997, 61384, 61769, 62152,
+	62534, 62915, 63294, 63671, 64047, 64421, 64794, 65166, 65536,
+};
+
+// 2^(i/128), Q30
+static const uint32_t exp2_table[129] = {
+	1073741824, 1079572136, 1085434106, 1091327906, 1097253708, 1103211687,
+	1109202018, 1115224875, 1121280436, 1127368878, 1133490379, 1139645120,
+	1145833280, 1152055042, 1158310587, 1164600099, 1170923762, 1177281762,
+	1183674286, 1190101520, 1196563654, 1203060876, 1209593378, 1216161350,
+	1222764986, 1229404479, 1236080024, 1242791816, 1249540052, 1256324931,
+	1263146652, 1270005413, 1276901417, 1283834865, 1290805962, 1297814910,
+	1304861917, 1311947188, 1319070932, 1326233356, 1333434672, 1340675091,
+	1347954824, 1355274085, 1362633090, 1370032052, 1377471191, 1384950723,
+	1392470869, 1400031848, 1407633882, 1415277195, 1422962010, 1430688553,
+	1438457051, 1446267730, 1454120821, 1462016553, 1469955159, 1477936870,
+	1485961921, 1494030547, 1502142985, 1510299473, 1518500250, 1526745556,
+	1535035634, 1543370725, 1551751076, 1560176931, 1568648537, 1577166143,
+	1585730000, 1594340357, 1602997467, 1611701585, 1620452965, 1629251865,
+	1638098541, 1646993254, 1655936265, 1664927835, 1673968228, 1683057710,
+	1692196547, 1701385007, 1710623359, 1719911875, 1729250827, 1738640488,
+	1748081133, 1757573041, 1767116489, 1776711757, 1786359126, 1796058879,
+	1805811301, 1815616678, 1825475297, 1835387448, 1845353420, 1855373507,
+	1865448001, 1875577199, 1885761398, 1896000896, 1906295993, 1916646992,
+	1927054196, 1937517909, 1948038440, 1958616096, 1969251188, 1979944027,
+	1990694927, 2001504204, 2012372174, 2023299156, 2034285470, 2045331439,
+	2056437387, 2067603638, 2078830522, 2090118366, 2101467502, 2112878262,
+	2124350982, 2135885998, 2147483648,
+};
+
+#define LEVEL_FLOOR     (-16 * 65536)     // about -96 dBFS
+#define GAIN_MIN        (-24 * 65536)
+#define GAIN_MAX        ((7 << 16) - 1)   // just under +42 dB
+#define FULL_SCALE      (15 << 16)        // log2 of 32768
+
+// log2 of a non-zero integer, Q16
+static inline int32_t log2_int(uint32_t n) __attribute__((always_inline, unused));
+static inline int32_t log2_int(uint32_t n)
+{
+	int32_t bits = 31 - __builtin_clz(n);
+	uint32_t m = n << (31 - bits);        // leading 1 at bit 31
+	uint32_t index = (m >> 24) & 127;
+	int32_t frac = (m >> 16) & 255;
+	int32_t val1 = log2_table[index];
+	int32_t val2 = log2_table[index + 1];
+	return (bits << 16) + val1 + (((val2 - val1) * frac) >> 8);
+}
+
+static inline int32_t log2_int64(uint64_t n) __attribute__((always_inline, unused));
+static inline int32_t log2_int64(uint64_t n)
+{
+	uint32_t hi = n >> 32;
+	if (hi == 0) return log2_int((uint32_t)n);
+	int32_t shift = 32 - __builtin_clz(hi);
+	return log2_int((uint32_t)(n >> shift)) + (shift << 16);
+}
+
+// 2^n, for n from GAIN_MIN to GAIN_MAX, as linear gain in Q24
+static inline int32_t exp2_gain(int32_t n) __attribute__((always_inline, unused));
+static inline int32_t exp2_gain(int32_t n)
+{
+	int32_t whole = n >> 16;
+	uint32_t index = (n >> 9) & 127;
+	uint32_t frac = (n >> 2) & 127;
+	// unsigned, as the last entry is 2^31
+	uint32_t val1 = exp2_table[index];
+	uint32_t val2 = exp2_table[index + 1];
+	uint32_t m = val1 + (((val2 - val1) * frac) >> 7);
+	return m >> (6 - whole);
+}
+
+AudioEffectDynamics::AudioEffectDynamics(void) : AudioStream(2, inputQueueArray)
+{
+	memset(delayline, 0, sizeof(delayline));
+	envelope = LEVEL_FLOOR;
+	hold_count = 0;
+	gain_change = 0;
+	head = 0;
+	makeup = 0;
+	delay_length = 0;
+	comp_slope = 0;
+	exp_slope = 0;
+	compression(0.0f, 1.0f, 0.0f);
+	expansion(-96.0f, 1.0f, 0.0f);
+	detector(DYNAMICS_DETECT_PEAK);
+	attack(5.0f);
+	release(100.0f);
+}
+
+int32_t AudioEffectDynamics::timeCoefficient(float milliseconds)
+{
+	float samples = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+	if (samples < 1.0f) return 0x7FFFFFFF;
+	return (1.0f - expf(-1.0f / samples)) * 2147483647.0f;
+}
+
+void AudioEffectDynamics::compression(float threshold_dB, float ratio, float knee_dB)
+{
+	if (ratio < 1.0f) ratio = 1.0f;
+	setCompression(threshold_dB, 1.0f - 1.0f / ratio, knee_dB);
+}
+
+void AudioEffectDynamics::limit(float threshold_dB, float knee_dB)
+{
+	// 1 - 1/ratio is exactly 1.0 when the ratio is infinite
+	setCompression(threshold_dB, 1.0f, knee_dB);
+}
+
+void AudioEffectDynamics::setCompression(float threshold_dB, float slope, float knee_dB)
+{
+	if (threshold_dB > 0.0f) threshold_dB = 0.0f;
+	if (knee_dB < 0.5f) knee_dB = 0.0f;
+	else if (knee_dB > 48.0f) knee_dB = 48.0f;
+	int32_t threshold = decibelsToLog(threshold_dB);
+	int32_t knee = decibelsToLog(knee_dB);
+	int32_t kcoef = 0;
+	if (knee > 0) kcoef = slope * 65536.0f / (float)(knee * 2) * 268435456.0f;
+	__disable_irq();
+	comp_threshold = threshold;
+	comp_slope = slope * 1073741824.0f;
+	knee_half = knee / 2;
+	knee_coef = kcoef;
+	updateFloor();
+	__enable_irq();
+}
+
+void AudioEffectDynamics::expansion(float threshold_dB, float ratio, float range_dB)
+{
+	if (ratio < 1.0f) ratio = 1.0f;
+	else if (ratio > 50.0f) ratio = 50.0f;
+	if (threshold_dB > 0.0f) threshold_dB = 0.0f;
+	if (range_dB < 0.0f) range_dB = 0.0f;
+	else if (range_dB > 144.0f) range_dB = 144.0f;
+	int32_t threshold = decibelsToLog(threshold_dB);
+	int32_t range = -(int32_t)(range_dB * (65536.0f / 6.0206f));
+	__disable_irq();
+	exp_threshold = threshold;
+	exp_slope = (ratio - 1.0f) * 65536.0f;
+	exp_range = range;
+	updateFloor();
+	__enable_irq();
+}
+
+// Below this level the gain never changes, so the detector need not follow
+// the signal any lower.  This keeps the attack quick after silence.
+void AudioEffectDynamics::updateFloor(void)
+{
+	int32_t floor = 0;
+	if (comp_slope > 0) floor = comp_threshold - knee_half;
+	if (exp_slope > 0) {
+		int32_t n = exp_threshold + (int32_t)(((int64_t)exp_range << 16) / exp_slope);
+		if (n < floor) floor = n;
+	}
+	if (floor < LEVEL_FLOOR) floor = LEVEL_FLOOR;
+	level_floor = floor;
+}
+
+void AudioEffectDynamics::detector(int mode, float milliseconds)
+{
+	uint32_t n = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f) + 0.5f;
+	if (n < 1) n = 1;
+	else if (n > DYNAMICS_BUFFER_SIZE) n = DYNAMICS_BUFFER_SIZE;
+	int32_t nlog = log2_int(n);
+	__disable_irq();
+	detect_mode = (mode == DYNAMICS_DETECT_RMS) ? DYNAMICS_DETECT_RMS : DYNAMICS_DETECT_PEAK;
+	memset(window, 0, sizeof(window));
+	window_sum = 0;
+	window_length = n;
+	window_log = nlog;
+	__enable_irq();
+}
+
+void AudioEffectDynamics::lookahead(float milliseconds)
+{
+	uint32_t n = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f) + 0.5f;
+	if (n > DYNAMICS_BUFFER_SIZE - 1) n = DYNAMICS_BUFFER_SIZE - 1;
+	__disable_irq();
+	delay_length = n;
+	__enable_irq();
+}
+
+// gain change in dB (as log2, Q16) for a level
+int32_t AudioEffectDynamics::computeGain(int32_t level)
+{
+	int32_t gain = 0;
+	int32_t d = level - comp_threshold;
+	if (d >= knee_half) {
+		gain = -multiply_32x32_rshift32(d << 2, comp_slope);
+	} else if (d > -knee_half) {
+		// quadratic curve joining the flat and sloped parts
+		int32_t t = d + knee_half;
+		int32_t u = multiply_32x32_rshift32(t << 4, knee_coef);
+		gain = -multiply_32x32_rshift32(u << 8, t << 8);
+	}
+	d = level - exp_threshold;
+	if (d < 0) {
+		int32_t e = multiply_32x32_rshift32(d << 8, exp_slope << 8);
+		if (e < exp_range) e = exp_range;
+		gain += e;
+	}
+	return gain;
+}
+
+void AudioEffectDynamics::update(void)
+{
+	audio_block_t *block, *sidechain;
+	const int16_t *detect;
+
+	block = receiveWritable(0);
+	if (!block) {
+		// keep running on silence, so the lookahead and detector drain
+		block = allocate();
+		if (!block) return;
+		memset(block->data, 0, sizeof(block->data));
+	}
+	sidechain = receiveReadOnly(1);
+	detect = sidechain ? sidechain->data : block->data;
+
+	uint32_t h = head;
+	uint32_t wlen = window_length;
+	uint32_t dlen = delay_length;
+	uint64_t sum = window_sum;
+	uint32_t hold = hold_count;
+	int32_t floor = level_floor;
+	int32_t env = envelope;
+	if (env < floor) env = floor;
+	int32_t level_prev = env;
+	int32_t gain = 0;
+	int32_t mult = 0;
+	const bool rms = (detect_mode == DYNAMICS_DETECT_RMS);
+	const uint32_t hold_length = rms ? 0 : wlen;
+
+	for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		int32_t s = detect[i];
+		int32_t level;
+		if (rms) {
+			int32_t old = window[(h - wlen) & (DYNAMICS_BUFFER_SIZE - 1)];
+			window[h] = s;
+			sum += (uint32_t)(s * s);
+			sum -= (uint32_t)(old * old);
+			if (sum > 0) {
+				level = ((log2_int64(sum) - window_log) >> 1) - FULL_SCALE;
+			} else {
+				level = LEVEL_FLOOR;
+			}
+		} else {
+			if (s < 0) s = -s;
+			level = (s > 0) ? log2_int(s) - FULL_SCALE : LEVEL_FLOOR;
+		}
+		if (level < floor) level = floor;
+		int32_t diff = level - env;
+		if (diff >= 0) {
+			env += multiply_32x32_rshift32(diff << 1, attack_coef);
+			hold = hold_length;
+		} else if (hold > 0) {
+			// peaks are held for the window time, so the level does
+			// not fall back between the peaks of each waveform cycle
+			hold--;
+		} else {
+			env += multiply_32x32_rshift32(diff << 1, release_coef);
+		}
+		if (env != level_prev || i == 0) {
+			// the gain only needs computing when the smoothed level moves
+			level_prev = env;
+			gain = computeGain(env);
+			int32_t total = gain + makeup;
+			if (total < GAIN_MIN) total = GAIN_MIN;
+			else if (total > GAIN_MAX) total = GAIN_MAX;
+			mult = exp2_gain(total);
+		}
+		delayline[h] = block->data[i];
+		int32_t val = delayline[(h - dlen) & (DYNAMICS_BUFFER_SIZE - 1)];
+		h = (h + 1) & (DYNAMICS_BUFFER_SIZE - 1);
+		block->data[i] = saturate16(signed_multiply_32x16b(mult, val) >> 8);
+	}
+	head = h;
+	window_sum = sum;
+	hold_count = hold;
+	envelope = env;
+	gain_change = gain;
+	transmit(block);
+	AudioStream::release(block);
+	if (sidechain) AudioStream::release(sidechain);
+}
@@ -0,0 +1,136 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef effect_dynamics_h_
+#define effect_dynamics_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Compressor, limiter, expander and gate.  The level of the sidechain input
+// (or the audio itself, if nothing is connected to the sidechain) is measured
+// every sample, converted to a logarithmic scale by table lookup, smoothed
+// by the attack and release times, and the gain computed from it is applied
+// to the audio delayed by the lookahead time.  All of this is fixed point,
+// so many channels may be used even on Teensy 3.2.
+//
+// Levels are held internally in units of log2 (about 6.02 dB) as Q16.
+
+#define DYNAMICS_DETECT_PEAK   0
+#define DYNAMICS_DETECT_RMS    1
+
+#define DYNAMICS_BUFFER_SIZE   256  // lookahead and RMS window, samples
+
+class AudioEffectDynamics : public AudioStream
+{
+public:
+	AudioEffectDynamics(void);
+	virtual void update(void);
+
+	// reduce the level above threshold by ratio, eg 4.0 means each 4 dB
+	// of input above the threshold produces 1 dB of output.  The knee
+	// smooths the transition over a range of levels centred on the threshold.
+	void compression(float threshold_dB, float ratio = 4.0f, float knee_dB = 6.0f);
+	// hold the level at the threshold, as if the ratio were infinite
+	void limit(float threshold_dB, float knee_dB = 0.0f);
+	// increase attenuation below the threshold, eg ratio 2.0 means each 1 dB
+	// of input below the threshold produces 2 dB less output, up to a
+	// maximum of range dB of attenuation.
+	void expansion(float threshold_dB, float ratio = 2.0f, float range_dB = 60.0f);
+	// mute signals below the threshold, by range dB
+	void gate(float threshold_dB, float range_dB = 60.0f) {
+		expansion(threshold_dB, 50.0f, range_dB);
+	}
+	// measure peaks, held for a window of time before the release begins,
+	// or the RMS over a window of time
+	void detector(int mode, float milliseconds = 5.0f);
+	// time for the detected level to follow rising and falling signals
+	void attack(float milliseconds) {
+		int32_t n = timeCoefficient(milliseconds);
+		__disable_irq();
+		attack_coef = n;
+		__enable_irq();
+	}
+	void release(float milliseconds) {
+		int32_t n = timeCoefficient(milliseconds);
+		__disable_irq();
+		release_coef = n;
+		__enable_irq();
+	}
+	// delay the audio so the gain can change before a transient arrives
+	void lookahead(float milliseconds);
+	// gain added after compression
+	void makeupGain(float dB) {
+		int32_t n = decibelsToLog(dB);
+		__disable_irq();
+		makeup = n;
+		__enable_irq();
+	}
+	// gain change (not including makeup gain) at the end of the last update
+	float gainReduction(void) {
+		__disable_irq();
+		int32_t n = gain_change;
+		__enable_irq();
+		return (float)n * (6.0206f / 65536.0f);
+	}
+private:
+	static int32_t decibelsToLog(float dB) {
+		if (dB > 96.0f) dB = 96.0f;
+		else if (dB < -96.0f) dB = -96.0f;
+		return dB * (65536.0f / 6.0206f);
+	}
+	static int32_t timeCoefficient(float milliseconds);
+	void setCompression(float threshold_dB, float slope, float knee_dB);
+	void updateFloor(void);
+	int32_t computeGain(int32_t level);
+	audio_block_t *inputQueueArray[2];
+	int16_t delayline[DYNAMICS_BUFFER_SIZE];
+	int16_t window[DYNAMICS_BUFFER_SIZE];
+	uint64_t window_sum;   // sum of squares of the samples in the window
+	int32_t envelope;      // smoothed level
+	uint32_t hold_count;   // samples until the release begins
+	int32_t gain_change;
+	uint16_t head;
+	// settings
+	int32_t comp_threshold;
+	int32_t comp_slope;    // 1 - 1/ratio, Q30
+	int32_t knee_half;     // half the knee width
+	int32_t knee_coef;     // comp_slope / (2 * knee width), Q28
+	int32_t exp_threshold;
+	int32_t exp_slope;     // ratio - 1, Q16
+	int32_t exp_range;
+	int32_t level_floor;   // lowest level which changes the gain
+	int32_t makeup;
+	int32_t attack_coef;   // Q31
+	int32_t release_coef;  // Q31
+	int32_t window_log;    // log2 of window length
+	uint16_t window_length;
+	uint16_t delay_length;
+	uint8_t detect_mode;
+};
+
+#endif
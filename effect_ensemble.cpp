@@ -0,0 +1,203 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "effect_ensemble.h"
+#include "utility/dspinst.h"
+
+extern "C" {
+extern const int16_t AudioWaveformSine[257];
+}
+
+AudioEffectEnsemble::AudioEffectEnsemble(void) : AudioStream(1, inputQueueArray)
+{
+	buffer = NULL;
+	buffer_length = 0;
+	head = 0;
+	lfo_phase = 0;
+	num_voices = 3;
+	ramp_reset = true;
+	base_ms = 15.0f;
+	depth_ms = 3.0f;
+	spread_amount = 1.0f;
+	feedback_amount = 0.0f;
+	dry_level = 1.0f;
+	wet_level = 1.0f;
+	rate(0.5f);
+	updateDelays();
+	updateGains();
+}
+
+bool AudioEffectEnsemble::begin(int16_t *delayline, uint32_t length)
+{
+	__disable_irq();
+	buffer = NULL;
+	__enable_irq();
+	if (!delayline || length < 8) return false;
+	memset(delayline, 0, length * sizeof(int16_t));
+	__disable_irq();
+	buffer = delayline;
+	buffer_length = length;
+	head = 0;
+	ramp_reset = true;
+	__enable_irq();
+	updateDelays();
+	return true;
+}
+
+void AudioEffectEnsemble::voices(int n)
+{
+	if (n < 1) n = 1;
+	else if (n > ENSEMBLE_MAX_VOICES) n = ENSEMBLE_MAX_VOICES;
+	__disable_irq();
+	num_voices = n;
+	ramp_reset = true;
+	__enable_irq();
+	updateGains();
+}
+
+void AudioEffectEnsemble::updateDelays(void)
+{
+	const float samples_per_ms = AUDIO_SAMPLE_RATE_EXACT / 1000.0f;
+	float base = base_ms * samples_per_ms;
+	float depth = depth_ms * samples_per_ms;
+	// the delay must stay at least 1 sample, and within the delay line
+	float longest = (buffer_length > 8) ? (float)(buffer_length - 2) : 65535.0f;
+	if (longest > 32767.0f) longest = 32767.0f;
+	if (depth < 0.0f) depth = 0.0f;
+	if (depth > (longest - 1.0f) * 0.5f) depth = (longest - 1.0f) * 0.5f;
+	if (base < depth + 1.0f) base = depth + 1.0f;
+	if (base > longest - depth) base = longest - depth;
+	__disable_irq();
+	delay_base = base * 65536.0f;
+	delay_depth = depth * 65536.0f;
+	__enable_irq();
+}
+
+void AudioEffectEnsemble::updateGains(void)
+{
+	int16_t left[ENSEMBLE_MAX_VOICES], right[ENSEMBLE_MAX_VOICES];
+	uint32_t n = num_voices;
+	float wet = wet_level / (float)n;
+	if (wet > 1.99f) wet = 1.99f;
+	else if (wet < -1.99f) wet = -1.99f;
+	for (uint32_t v=0; v < n; v++) {
+		// each voice's place in the stereo field, -1 left to +1 right
+		float pan = 0.0f;
+		if (n > 1) pan = spread_amount * ((float)(2 * v) / (float)(n - 1) - 1.0f);
+		if (pan > 1.0f) pan = 1.0f;
+		else if (pan < -1.0f) pan = -1.0f;
+		float l = (pan > 0.0f) ? 1.0f - pan : 1.0f;
+		float r = (pan < 0.0f) ? 1.0f + pan : 1.0f;
+		left[v] = l * wet * 16384.0f;
+		right[v] = r * wet * 16384.0f;
+	}
+	float dry = dry_level;
+	if (dry > 1.99f) dry = 1.99f;
+	else if (dry < -1.99f) dry = -1.99f;
+	__disable_irq();
+	memcpy(gain_left, left, sizeof(left[0]) * n);
+	memcpy(gain_right, right, sizeof(right[0]) * n);
+	gain_dry = dry * 16384.0f;
+	gain_feedback = feedback_amount / (float)n * 16384.0f;
+	__enable_irq();
+}
+
+void AudioEffectEnsemble::update(void)
+{
+	audio_block_t *block, *left, *right;
+	int32_t delay[ENSEMBLE_MAX_VOICES], increment[ENSEMBLE_MAX_VOICES];
+	uint32_t i, v;
+
+	block = receiveReadOnly(0);
+	if (!buffer) {
+		if (block) release(block);
+		return;
+	}
+	left = allocate();
+	right = allocate();
+	if (!left || !right) {
+		if (left) release(left);
+		if (right) release(right);
+		if (block) release(block);
+		return;
+	}
+
+	// the LFO is read once per block, with the voices' phases spaced evenly
+	const uint32_t n = num_voices;
+	const uint32_t spacing = (n > 1) ? (uint32_t)(0x100000000ull / n) : 0;
+	lfo_phase += lfo_increment;
+	for (v=0; v < n; v++) {
+		uint32_t ph = lfo_phase + v * spacing;
+		uint32_t index = ph >> 24;
+		int32_t val1 = AudioWaveformSine[index];
+		int32_t val2 = AudioWaveformSine[index+1];
+		uint32_t scale = (ph >> 8) & 0xFFFF;
+		int32_t lfo = (val1 * (int32_t)(0x10000 - scale) + val2 * (int32_t)scale) >> 16;
+		int32_t end = delay_base + (signed_multiply_32x16b(delay_depth, lfo) << 1);
+		int32_t start = ramp_reset ? end : voice_delay[v];
+		delay[v] = start;
+		increment[v] = (end - start) / AUDIO_BLOCK_SAMPLES;
+		voice_delay[v] = end;
+	}
+	ramp_reset = false;
+
+	const uint32_t len = buffer_length;
+	const int32_t dry = gain_dry;
+	const int32_t fbgain = gain_feedback;
+	uint32_t h = head;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		int32_t in = block ? block->data[i] : 0;
+		int32_t suml = in * dry;
+		int32_t sumr = suml;
+		int32_t fb = 0;
+		for (v=0; v < n; v++) {
+			int32_t d = delay[v] + increment[v];
+			delay[v] = d;
+			// h holds the newest sample, 1 sample old
+			int32_t index = h + 1 - (d >> 16);
+			if (index < 0) index += len;
+			int32_t index2 = (index > 0) ? index - 1 : len - 1;
+			int32_t a = buffer[index];
+			int32_t b = buffer[index2];
+			int32_t val = a + (((b - a) * (int32_t)((d & 0xFFFF) >> 1)) >> 15);
+			suml += val * gain_left[v];
+			sumr += val * gain_right[v];
+			fb += val;
+		}
+		if (++h >= len) h = 0;
+		buffer[h] = saturate16(in + ((fb * fbgain) >> 14));
+		left->data[i] = saturate16(suml >> 14);
+		right->data[i] = saturate16(sumr >> 14);
+	}
+	head = h;
+	if (block) release(block);
+	transmit(left, 0);
+	release(left);
+	transmit(right, 1);
+	release(right);
+}
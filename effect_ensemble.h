@@ -0,0 +1,114 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef effect_ensemble_h_
+#define effect_ensemble_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Multi-voice chorus, ensemble and flanger.  All voices read one delay line,
+// each with its own phase of a shared sine LFO, which is looked up once per
+// block.  The delay of each voice is ramped smoothly across the block and
+// interpolated between samples, so there are no zipper artefacts.  The voices
+// are spread across the stereo outputs, and may be fed back into the delay.
+
+#define ENSEMBLE_MAX_VOICES 8
+
+class AudioEffectEnsemble : public AudioStream
+{
+public:
+	AudioEffectEnsemble(void);
+	// delay memory, in any RAM including EXTMEM
+	bool begin(int16_t *delayline, uint32_t length);
+	virtual void update(void);
+
+	// number of voices, 1 to 8, with LFO phases spaced evenly
+	void voices(int n);
+	// centre delay, and how far the LFO moves it either way
+	void delay(float milliseconds) {
+		base_ms = milliseconds;
+		updateDelays();
+	}
+	void depth(float milliseconds) {
+		depth_ms = milliseconds;
+		updateDelays();
+	}
+	// LFO frequency
+	void rate(float hz) {
+		if (hz < 0.0f) hz = 0.0f;
+		else if (hz > 20.0f) hz = 20.0f;
+		uint32_t n = hz * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT) * AUDIO_BLOCK_SAMPLES;
+		__disable_irq();
+		lfo_increment = n;
+		__enable_irq();
+	}
+	// 0 = all voices in the centre, 1 = spread from left to right
+	void spread(float amount) {
+		spread_amount = amount;
+		updateGains();
+	}
+	// amount of the voices fed back into the delay, -0.95 to +0.95
+	void feedback(float amount) {
+		if (amount > 0.95f) amount = 0.95f;
+		else if (amount < -0.95f) amount = -0.95f;
+		feedback_amount = amount;
+		updateGains();
+	}
+	// levels of the input and of the delayed voices in the output
+	void mix(float dry, float wet) {
+		dry_level = dry;
+		wet_level = wet;
+		updateGains();
+	}
+private:
+	void updateDelays(void);
+	void updateGains(void);
+	audio_block_t *inputQueueArray[1];
+	int16_t *buffer;
+	uint32_t buffer_length;
+	uint32_t head;
+	uint32_t lfo_phase;
+	uint32_t lfo_increment;        // per block
+	int32_t voice_delay[ENSEMBLE_MAX_VOICES]; // at end of last block, Q16
+	int16_t gain_left[ENSEMBLE_MAX_VOICES];   // Q14
+	int16_t gain_right[ENSEMBLE_MAX_VOICES];
+	int16_t gain_dry;              // Q14
+	int16_t gain_feedback;         // Q14, divided by number of voices
+	int32_t delay_base;            // Q16 samples
+	int32_t delay_depth;           // Q16 samples
+	uint8_t num_voices;
+	bool ramp_reset;               // jump to the new delays
+	float base_ms;
+	float depth_ms;
+	float spread_amount;
+	float feedback_amount;
+	float dry_level;
+	float wet_level;
+};
+
+#endif
@@ -39,6 +39,20 @@
 void AudioEffectEnvelope::noteOn(void)
 {
 	__disable_irq();
+	triggerOn();
+	__enable_irq();
+}
+
+void AudioEffectEnvelope::noteOff(void)
+{
+	__disable_irq();
+	triggerOff();
+	__enable_irq();
+}
+
+// start the note, with interrupts already disabled or from update()
+void AudioEffectEnvelope::triggerOn(void)
+{
 	if (state == STATE_IDLE || state == STATE_DELAY || release_forced_count == 0) {
 		mult_hires = 0;
 		count = delay_count;
@@ -55,30 +69,33 @@ void AudioEffectEnvelope::noteOn(void)
 		count = release_forced_count;
 		inc_hires = (-mult_hires) / (int32_t)count;
 	}
-	__enable_irq();
 }
 
-void AudioEffectEnvelope::noteOff(void)
+void AudioEffectEnvelope::triggerOff(void)
 {
-	__disable_irq();
 	if (state != STATE_RELEASE && state != STATE_IDLE && state != STATE_FORCED) {
 		state = STATE_RELEASE;
 		count = release_count;
 		inc_hires = (-mult_hires) / (int32_t)count;
 	}
-	__enable_irq();
 }
 
 void AudioEffectEnvelope::update(void)
 {
 	audio_block_t *block;
-	uint32_t *p, *end;
+	uint32_t *p, *begin, *end;
 	uint32_t sample12, sample34, sample56, sample78, tmp1, tmp2;
+	audio_event_t event;
+	bool events = false;
 
+	if (event_queue) {
+		event_queue->beginBlock();
+		events = event_queue->nextOffset() < AUDIO_BLOCK_SAMPLES;
+	}
 	block = receiveWritable();
 	if (block)
 	{
-		if (state == STATE_IDLE) {
+		if (state == STATE_IDLE && !events) {
 			AudioStream::release(block);
 			return;
 		}
@@ -87,12 +104,33 @@ void AudioEffectEnvelope::update(void)
 	else
 		p = NULL;
 	
+	begin = p;
 	end = p + AUDIO_BLOCK_SAMPLES/2;
 
 	// need to run the envelope process even with silent data, or
 	// it gets stuck and never goes idle:
 	while (p < end) 
 	{
+		// events take effect on the nearest 8 sample boundary
+		if (events) {
+			int offset = (p - begin) * 2;
+			while (event_queue->pop(offset + 4, event)) {
+				if (event.param == AUDIO_EVENT_NOTE_ON) triggerOn();
+				else if (event.param == AUDIO_EVENT_NOTE_OFF) triggerOff();
+			}
+		}
+		if (state == STATE_IDLE) {
+			if (nullptr != block)
+			{
+				*p++ = 0;
+				*p++ = 0;
+				*p++ = 0;
+				*p++ = 0;
+			}
+			else
+				p += 4;
+			continue;
+		}
 		// we only care about the state when completing a region
 		if (count == 0) {
 			if (state == STATE_ATTACK) {
@@ -120,19 +158,9 @@ void AudioEffectEnvelope::update(void)
 			} else if (state == STATE_SUSTAIN) {
 				count = 0xFFFF;
 			} else if (state == STATE_RELEASE) {
+				// the rest of the block is zero, unless an event restarts it
 				state = STATE_IDLE;
-				while (p < end) {
-					if (nullptr != block) // because p doesn't stay null!
-					{
-						*p++ = 0;
-						*p++ = 0;
-						*p++ = 0;
-						*p++ = 0;
-					}
-					else
-						p += 4;
-				}
-				break;
+				continue;
 			} else if (state == STATE_FORCED) {
 				mult_hires = 0;
 				count = delay_count;
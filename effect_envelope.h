@@ -29,6 +29,7 @@
 #include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
 #include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
 #include "utility/dspinst.h"
+#include "event_queue.h"
 
 #define SAMPLES_PER_MSEC (AUDIO_SAMPLE_RATE_EXACT/1000.0f)
 
@@ -37,6 +38,7 @@ class AudioEffectEnvelope : public AudioStream
 public:
 	AudioEffectEnvelope() : AudioStream(1, inputQueueArray) {
 		state = 0;
+		event_queue = NULL;
 		delay(0.0f);  // default values...
 		attack(10.5f);
 		hold(2.5f);
@@ -76,8 +78,15 @@ public:
 	}
 	bool isActive();
 	bool isSustain();
+	// sample accurate AUDIO_EVENT_NOTE_ON and NOTE_OFF, posted to this
+	// queue, which take effect on the nearest 8 sample boundary
+	void eventQueue(AudioEventQueue &queue) {
+		event_queue = &queue;
+	}
 	virtual void update(void);
 private:
+	void triggerOn();
+	void triggerOff();
 	uint16_t milliseconds2count(float milliseconds) {
 		if (milliseconds < 0.0f) milliseconds = 0.0f;
 		uint32_t c = ((uint32_t)(milliseconds*SAMPLES_PER_MSEC)+7)>>3;
@@ -99,7 +108,7 @@ private:
 	int32_t  sustain_mult;
 	uint16_t release_count;
 	uint16_t release_forced_count;
-
+	AudioEventQueue *event_queue;
 };
 
 #undef SAMPLES_PER_MSEC
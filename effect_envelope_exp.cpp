@@ -0,0 +1,270 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "effect_envelope_exp.h"
+#include "utility/dspinst.h"
+
+#define STATE_IDLE	0
+#define STATE_DELAY	1
+#define STATE_ATTACK	2
+#define STATE_HOLD	3
+#define STATE_DECAY	4
+#define STATE_SUSTAIN	5
+#define STATE_RELEASE	6
+
+#define STEPS (AUDIO_BLOCK_SAMPLES / ENVELOPE_EXP_CHUNK)
+
+AudioEffectEnvelopeExp::AudioEffectEnvelopeExp() : AudioStream(4, inputQueueArray)
+{
+	state = STATE_IDLE;
+	count = 0;
+	level = 0.0f;
+	target = 0.0f;
+	end_level = 0.0f;
+	ratio = 0.0f;
+	event_queue = NULL;
+	delay(0.0f);  // default values...
+	attack(10.5f);
+	hold(2.5f);
+	decay(35.0f);
+	sustain(0.5f);
+	release(300.0f);
+	curve(0.5f);
+}
+
+void AudioEffectEnvelopeExp::curve(float shape)
+{
+	if (shape < 0.0f) shape = 0.0f;
+	else if (shape > 1.0f) shape = 1.0f;
+	// the target is 1000 (nearly linear) to 0.001 (-60 dB) times the
+	// segment's height past its end
+	float n = powf(10.0f, 3.0f - 6.0f * shape);
+	float log_n = logf((1.0f + n) / n);
+	__disable_irq();
+	overshoot = n;
+	log_overshoot = log_n;
+	__enable_irq();
+}
+
+void AudioEffectEnvelopeExp::noteOn(void)
+{
+	__disable_irq();
+	triggerOn();
+	__enable_irq();
+}
+
+void AudioEffectEnvelopeExp::noteOff(void)
+{
+	__disable_irq();
+	triggerOff();
+	__enable_irq();
+}
+
+// a new note starts from the present level, so there is no click
+void AudioEffectEnvelopeExp::triggerOn(void)
+{
+	if (delay_chunks > 0) {
+		state = STATE_DELAY;
+		count = delay_chunks;
+	} else {
+		startSegment(STATE_ATTACK, 1.0f, attack_samples);
+	}
+}
+
+void AudioEffectEnvelopeExp::triggerOff(void)
+{
+	if (state != STATE_IDLE && state != STATE_RELEASE) {
+		startSegment(STATE_RELEASE, 0.0f, release_samples);
+	}
+}
+
+// The level follows target + (level - target) * ratio^n.  With the target
+// overshoot times the segment's height past the end, the end is reached
+// after log((1 + overshoot) / overshoot) time constants, whatever the
+// starting level.
+void AudioEffectEnvelopeExp::startSegment(uint8_t segment, float end, float samples)
+{
+	state = segment;
+	end_level = end;
+	if (samples < ENVELOPE_EXP_CHUNK || level == end) {
+		target = end;
+		ratio = 0.0f;  // reach the end at the next step
+		return;
+	}
+	target = end + overshoot * (end - level);
+	ratio = expf(-log_overshoot * ENVELOPE_EXP_CHUNK / samples);
+}
+
+void AudioEffectEnvelopeExp::nextSegment(void)
+{
+	switch (state) {
+	case STATE_DELAY:
+		startSegment(STATE_ATTACK, 1.0f, attack_samples);
+		break;
+	case STATE_ATTACK:
+		if (hold_chunks > 0) {
+			state = STATE_HOLD;
+			count = hold_chunks;
+			break;
+		}
+		// fall through
+	case STATE_HOLD:
+		startSegment(STATE_DECAY, sustain_level, decay_samples);
+		break;
+	case STATE_DECAY:
+		state = STATE_SUSTAIN;
+		break;
+	case STATE_RELEASE:
+		state = STATE_IDLE;
+		level = 0.0f;
+		break;
+	}
+}
+
+// advance the envelope by one step of ENVELOPE_EXP_CHUNK samples
+void AudioEffectEnvelopeExp::step(void)
+{
+	switch (state) {
+	case STATE_IDLE:
+	case STATE_SUSTAIN:
+		break;
+	case STATE_DELAY:
+	case STATE_HOLD:
+		if (--count == 0) nextSegment();
+		break;
+	default:
+		level = target + (level - target) * ratio;
+		if ((target >= end_level) ? (level >= end_level) : (level <= end_level)) {
+			level = end_level;
+			nextSegment();
+		}
+	}
+}
+
+// multiply by the gain, ramped between steps, 2 samples per 32 bit word
+static void applyRamp(int16_t *data, const int32_t *mult)
+{
+	uint32_t *p = (uint32_t *)data;
+
+	for (int i=0; i < STEPS; i++) {
+		int32_t m = mult[i];
+		int32_t inc = (mult[i + 1] - m) / ENVELOPE_EXP_CHUNK;
+		const uint32_t *end = p + ENVELOPE_EXP_CHUNK / 2;
+		do {
+			uint32_t pair = *p;
+			m += inc;
+			int32_t val1 = signed_multiply_32x16b(m, pair);
+			m += inc;
+			int32_t val2 = signed_multiply_32x16t(m, pair);
+			*p++ = pack_16b_16b(val2, val1);
+		} while (p < end);
+	}
+}
+
+void AudioEffectEnvelopeExp::update(void)
+{
+	audio_block_t *block;
+	audio_event_t event;
+	int32_t mult[STEPS + 1];
+	bool events = false;
+	bool unity = true;
+	int i, ch;
+
+	if (event_queue) {
+		event_queue->beginBlock();
+		events = event_queue->nextOffset() < AUDIO_BLOCK_SAMPLES;
+	}
+	if (state == STATE_IDLE && !events) {
+		for (ch=0; ch < 4; ch++) {
+			block = receiveReadOnly(ch);
+			if (block) AudioStream::release(block);
+		}
+		return;
+	}
+
+	// the gain at every step, 65536 = 1.0
+	for (i=0; i <= STEPS; i++) {
+		if (i > 0) step();
+		if (events && i < STEPS) {
+			// events take effect on the nearest step
+			int offset = i * ENVELOPE_EXP_CHUNK + ENVELOPE_EXP_CHUNK / 2;
+			while (event_queue->pop(offset, event)) {
+				if (event.param == AUDIO_EVENT_NOTE_ON) triggerOn();
+				else if (event.param == AUDIO_EVENT_NOTE_OFF) triggerOff();
+			}
+		}
+		float n = level;
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		mult[i] = n * 65536.0f;
+		if (mult[i] != 65536) unity = false;
+	}
+
+	for (ch=0; ch < 4; ch++) {
+		if (unity) {
+			block = receiveReadOnly(ch);
+			if (!block) continue;
+		} else {
+			block = receiveWritable(ch);
+			if (!block) continue;
+			applyRamp(block->data, mult);
+		}
+		transmit(block, ch);
+		AudioStream::release(block);
+	}
+
+	// the envelope itself, on output 4
+	block = allocate();
+	if (block) {
+		int16_t *p = block->data;
+		for (i=0; i < STEPS; i++) {
+			int32_t m = mult[i];
+			int32_t inc = (mult[i + 1] - m) / ENVELOPE_EXP_CHUNK;
+			for (int j=0; j < ENVELOPE_EXP_CHUNK; j++) {
+				m += inc;
+				*p++ = (m * 32767) >> 16;
+			}
+		}
+		transmit(block, 4);
+		AudioStream::release(block);
+	}
+}
+
+bool AudioEffectEnvelopeExp::isActive()
+{
+	uint8_t current_state = *(volatile uint8_t *)&state;
+	if (current_state == STATE_IDLE) return false;
+	return true;
+}
+
+bool AudioEffectEnvelopeExp::isSustain()
+{
+	uint8_t current_state = *(volatile uint8_t *)&state;
+	if (current_state == STATE_SUSTAIN) return true;
+	return false;
+}
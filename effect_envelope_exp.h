@@ -0,0 +1,117 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef effect_envelope_exp_h_
+#define effect_envelope_exp_h_
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include "event_queue.h"
+
+// Envelope with exponential segments, like an analog envelope generator.
+// Each segment approaches a target past its end level, so the curve()
+// setting goes from nearly straight lines to sharply exponential, and every
+// segment still takes exactly its set time.  The level is stepped once per
+// 16 samples, by one multiply, and ramped linearly between the steps.
+//
+// One envelope shapes up to 4 signals, each input to the same numbered
+// output.  Output 4 is the envelope itself, 0 to 1.0, for modulating other
+// objects.
+
+#define ENVELOPE_EXP_CHUNK 16
+
+class AudioEffectEnvelopeExp : public AudioStream
+{
+public:
+	AudioEffectEnvelopeExp();
+	void noteOn();
+	void noteOff();
+	void delay(float milliseconds) {
+		delay_chunks = milliseconds2chunks(milliseconds);
+	}
+	void attack(float milliseconds) {
+		attack_samples = milliseconds2samples(milliseconds);
+	}
+	void hold(float milliseconds) {
+		hold_chunks = milliseconds2chunks(milliseconds);
+	}
+	void decay(float milliseconds) {
+		decay_samples = milliseconds2samples(milliseconds);
+	}
+	void sustain(float level) {
+		if (level < 0.0f) level = 0.0f;
+		else if (level > 1.0f) level = 1.0f;
+		sustain_level = level;
+	}
+	void release(float milliseconds) {
+		release_samples = milliseconds2samples(milliseconds);
+	}
+	// 0 for nearly linear segments, to 1.0 for strongly exponential
+	void curve(float shape);
+	bool isActive();
+	bool isSustain();
+	// sample accurate AUDIO_EVENT_NOTE_ON and NOTE_OFF, posted to this
+	// queue, which take effect on the nearest 16 sample step
+	void eventQueue(AudioEventQueue &queue) {
+		event_queue = &queue;
+	}
+	virtual void update(void);
+private:
+	float milliseconds2samples(float milliseconds) {
+		if (milliseconds < 0.0f) milliseconds = 0.0f;
+		else if (milliseconds > 60000.0f) milliseconds = 60000.0f;
+		return milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+	}
+	uint32_t milliseconds2chunks(float milliseconds) {
+		return (milliseconds2samples(milliseconds) + ENVELOPE_EXP_CHUNK / 2)
+			/ ENVELOPE_EXP_CHUNK;
+	}
+	void triggerOn();
+	void triggerOff();
+	void startSegment(uint8_t segment, float end, float samples);
+	void nextSegment();
+	void step();
+	audio_block_t *inputQueueArray[4];
+	// state
+	uint8_t  state;          // idle, delay, attack, hold, decay, sustain, release
+	uint32_t count;          // steps left in delay or hold
+	float    level;          // 0 to 1.0
+	float    target;         // the level approaches this...
+	float    end_level;      // and the segment ends when it reaches this
+	float    ratio;          // (level - target) is multiplied by this every step
+	// settings
+	uint32_t delay_chunks;
+	float    attack_samples;
+	uint32_t hold_chunks;
+	float    decay_samples;
+	float    sustain_level;
+	float    release_samples;
+	float    overshoot;      // how far past the end level the target is
+	float    log_overshoot;  // log((1 + overshoot) / overshoot)
+	AudioEventQueue *event_queue;
+};
+
+#endif
@@ -491,3 +491,235 @@ void AudioEffectFreeverbStereo::update()
 
 
 
+
+
+static const uint16_t comb_lengths[8] = {
+	1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617
+};
+static const uint16_t allpass_lengths[4] = {
+	556, 441, 341, 225
+};
+#define STEREO_SPREAD 23
+
+// halfband lowpass, Kaiser window, beta 6.  Only the odd taps either side of
+// the centre (which is 0.5) are non-zero.  Flat to 7.9 kHz, -62 dB above
+// 14.1 kHz, so the little that aliases lands above the flat band.
+static const int16_t halfband[FREEVERB_HALFBAND_TAPS] = {
+	10303, -3113, 1527, -795, 393, -171, 58, -10
+};
+
+AudioEffectFreeverbStereoExt::AudioEffectFreeverbStereoExt() : AudioStream(1, inputQueueArray)
+{
+	memset(combL, 0, sizeof(combL));
+	memset(combR, 0, sizeof(combR));
+	memset(allpassL, 0, sizeof(allpassL));
+	memset(allpassR, 0, sizeof(allpassR));
+	memset(decimate_state, 0, sizeof(decimate_state));
+	memset(interpolateL_state, 0, sizeof(interpolateL_state));
+	memset(interpolateR_state, 0, sizeof(interpolateR_state));
+	damping_amount = 0.5f;
+	combdamp1 = 6553;
+	combdamp2 = 26215;
+	combfeeback = 27524;
+	half_rate = false;
+	ready = false;
+}
+
+bool AudioEffectFreeverbStereoExt::begin(int16_t *memory, uint32_t length, bool halfrate)
+{
+	__disable_irq();
+	ready = false;
+	__enable_irq();
+	uint32_t needed = halfrate ? FREEVERB_STEREO_MEMORY_HALFRATE : FREEVERB_STEREO_MEMORY;
+	if (!memory || length < needed) return false;
+	memset(memory, 0, needed * sizeof(int16_t));
+	// in half rate mode every delay is half as many samples, the same time
+	int shift = halfrate ? 1 : 0;
+	int16_t *p = memory;
+	for (int i=0; i < 8; i++) {
+		combL[i].buf = p;
+		combL[i].length = (comb_lengths[i] + shift) >> shift;
+		p += combL[i].length;
+		combR[i].buf = p;
+		combR[i].length = (comb_lengths[i] + STEREO_SPREAD + shift) >> shift;
+		p += combR[i].length;
+		combL[i].index = combR[i].index = 0;
+		combL[i].filter = combR[i].filter = 0;
+	}
+	for (int i=0; i < 4; i++) {
+		allpassL[i].buf = p;
+		allpassL[i].length = (allpass_lengths[i] + shift) >> shift;
+		p += allpassL[i].length;
+		allpassR[i].buf = p;
+		allpassR[i].length = (allpass_lengths[i] + STEREO_SPREAD + shift) >> shift;
+		p += allpassR[i].length;
+		allpassL[i].index = allpassR[i].index = 0;
+	}
+	memset(decimate_state, 0, sizeof(decimate_state));
+	memset(interpolateL_state, 0, sizeof(interpolateL_state));
+	memset(interpolateR_state, 0, sizeof(interpolateR_state));
+	__disable_irq();
+	half_rate = halfrate;
+	__enable_irq();
+	updateDamping();
+	__disable_irq();
+	ready = true;
+	__enable_irq();
+	return true;
+}
+
+void AudioEffectFreeverbStereoExt::updateDamping()
+{
+	float d = damping_amount * 0.4f;
+	// at half rate, a one pole lowpass needs d / (2 - d) for the same cutoff
+	if (half_rate) d = d / (2.0f - d);
+	int x1 = (int)(d * 32768.0f);
+	int x2 = 32768 - x1;
+	__disable_irq();
+	combdamp1 = x1;
+	combdamp2 = x2;
+	__enable_irq();
+}
+
+// n samples of the reverb at its own rate.  The combs are in parallel and
+// each one is run over all n samples before the next, and likewise for the
+// allpass filters in series, which keeps each buffer's index in a register.
+void AudioEffectFreeverbStereoExt::process(const int16_t *in, int16_t *outL, int16_t *outR, int n)
+{
+	int32_t sumL[AUDIO_BLOCK_SAMPLES];
+	int32_t sumR[AUDIO_BLOCK_SAMPLES];
+	const int32_t damp1 = combdamp1;
+	const int32_t damp2 = combdamp2;
+	const int32_t feedback = combfeeback;
+	int i, j;
+
+	memset(sumL, 0, n * sizeof(int32_t));
+	memset(sumR, 0, n * sizeof(int32_t));
+	for (j=0; j < 16; j++) {
+		comb_t *c = (j < 8) ? &combL[j] : &combR[j - 8];
+		int32_t *sum = (j < 8) ? sumL : sumR;
+		int16_t *buf = c->buf;
+		uint32_t index = c->index;
+		const uint32_t length = c->length;
+		int16_t filter = c->filter;
+		for (i=0; i < n; i++) {
+			int16_t bufout = buf[index];
+			sum[i] += bufout;
+			filter = sat16(bufout * damp2 + filter * damp1, 15);
+			buf[index] = sat16(in[i] + sat16(filter * feedback, 15), 0);
+			if (++index >= length) index = 0;
+		}
+		c->index = index;
+		c->filter = filter;
+	}
+	for (i=0; i < n; i++) {
+		outL[i] = sat16(sumL[i] * 31457, 17);
+		outR[i] = sat16(sumR[i] * 31457, 17);
+	}
+	for (j=0; j < 8; j++) {
+		allpass_t *a = (j < 4) ? &allpassL[j] : &allpassR[j - 4];
+		int16_t *out = (j < 4) ? outL : outR;
+		int16_t *buf = a->buf;
+		uint32_t index = a->index;
+		const uint32_t length = a->length;
+		for (i=0; i < n; i++) {
+			int16_t bufout = buf[index];
+			buf[index] = out[i] + (bufout >> 1);
+			out[i] = sat16(bufout - out[i], 1);
+			if (++index >= length) index = 0;
+		}
+		a->index = index;
+	}
+	for (i=0; i < n; i++) {
+		outL[i] = sat16(outL[i] * 30, 0);
+		outR[i] = sat16(outR[i] * 30, 0);
+	}
+}
+
+// 2x halfband interpolation, from n input samples to 2n output samples
+static void interpolate(const int16_t *in, int16_t *out, int16_t *state, int n)
+{
+	const int H = FREEVERB_HALFBAND_TAPS;
+	int16_t x[AUDIO_BLOCK_SAMPLES/2 + FREEVERB_HALFBAND_TAPS*2 - 1];
+
+	memcpy(x, state, (H*2 - 1) * sizeof(int16_t));
+	memcpy(x + H*2 - 1, in, n * sizeof(int16_t));
+	for (int m=0; m < n; m++) {
+		const int16_t *p = x + m + H*2 - 1;  // the newest input sample
+		int32_t sum = 0;
+		for (int j=0; j < H; j++) {
+			sum += halfband[j] * (p[j - H + 1] + p[-H - j]);
+		}
+		out[m*2] = sat16(sum, 14);
+		out[m*2 + 1] = p[1 - H];
+	}
+	memcpy(state, x + n, (H*2 - 1) * sizeof(int16_t));
+}
+
+void AudioEffectFreeverbStereoExt::update()
+{
+#if defined(__ARM_ARCH_7EM__)
+	const audio_block_t *block;
+	audio_block_t *outblockL;
+	audio_block_t *outblockR;
+	int16_t input[AUDIO_BLOCK_SAMPLES];
+	int i;
+
+	block = receiveReadOnly(0);
+	if (!ready) {
+		if (block) release((audio_block_t *)block);
+		return;
+	}
+	outblockL = allocate();
+	outblockR = allocate();
+	if (!outblockL || !outblockR) {
+		if (outblockL) release(outblockL);
+		if (outblockR) release(outblockR);
+		if (block) release((audio_block_t *)block);
+		return;
+	}
+	if (!block) block = &zeroblock;
+
+	if (!half_rate) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			input[i] = sat16(block->data[i] * 8738, 17); // for numerical headroom
+		}
+		process(input, outblockL->data, outblockR->data, AUDIO_BLOCK_SAMPLES);
+	} else {
+		const int H = FREEVERB_HALFBAND_TAPS;
+		const int n = AUDIO_BLOCK_SAMPLES / 2;
+		int16_t x[AUDIO_BLOCK_SAMPLES + FREEVERB_HALFBAND_TAPS*4 - 2];
+		int16_t outL[AUDIO_BLOCK_SAMPLES / 2];
+		int16_t outR[AUDIO_BLOCK_SAMPLES / 2];
+
+		// halfband decimation of the scaled input, keeping the odd samples'
+		// phase.  The centre tap lands on a sample, the others in pairs.
+		memcpy(x, decimate_state, (H*4 - 2) * sizeof(int16_t));
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			x[H*4 - 2 + i] = sat16(block->data[i] * 8738, 17);
+		}
+		for (i=0; i < n; i++) {
+			const int16_t *p = x + i*2 + H*2;  // the centre tap
+			int32_t sum = p[0] * 16384;
+			for (int j=0; j < H; j++) {
+				sum += halfband[j] * (p[j*2 + 1] + p[-j*2 - 1]);
+			}
+			input[i] = sat16(sum, 15);
+		}
+		memcpy(decimate_state, x + AUDIO_BLOCK_SAMPLES, (H*4 - 2) * sizeof(int16_t));
+		process(input, outL, outR, n);
+		interpolate(outL, outblockL->data, interpolateL_state, n);
+		interpolate(outR, outblockR->data, interpolateR_state, n);
+	}
+	transmit(outblockL, 0);
+	transmit(outblockR, 1);
+	release(outblockL);
+	release(outblockR);
+	if (block != &zeroblock) release((audio_block_t *)block);
+
+#elif defined(KINETISL)
+	audio_block_t *block;
+	block = receiveReadOnly(0);
+	if (block) release(block);
+#endif
+}
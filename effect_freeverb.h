@@ -181,5 +181,63 @@ private:
 };
 
 
+// The same stereo Freeverb, with its comb and allpass memory supplied by
+// begin(), so it may be placed in DMAMEM or EXTMEM.  In half rate mode the
+// reverb runs at 22.05 kHz, between a halfband decimator and interpolator,
+// for about half the CPU time and half the memory.  The tail is flat to about
+// 8 kHz in this mode.
+
+#define FREEVERB_STEREO_MEMORY          25450  // samples, full rate
+#define FREEVERB_STEREO_MEMORY_HALFRATE 12731  // samples, half rate
+#define FREEVERB_HALFBAND_TAPS          8      // per side, non-zero only
+
+class AudioEffectFreeverbStereoExt : public AudioStream
+{
+public:
+	AudioEffectFreeverbStereoExt();
+	bool begin(int16_t *memory, uint32_t length, bool halfrate = false);
+	virtual void update();
+	void roomsize(float n) {
+		if (n > 1.0f) n = 1.0f;
+		else if (n < 0.0f) n = 0.0f;
+		combfeeback = (int)(n * 9175.04f) + 22937;
+	}
+	void damping(float n) {
+		if (n > 1.0f) n = 1.0f;
+		else if (n < 0.0f) n = 0.0f;
+		damping_amount = n;
+		updateDamping();
+	}
+private:
+	struct comb_t {
+		int16_t *buf;
+		uint16_t length;
+		uint16_t index;
+		int16_t filter;
+	};
+	struct allpass_t {
+		int16_t *buf;
+		uint16_t length;
+		uint16_t index;
+	};
+	void updateDamping();
+	void process(const int16_t *in, int16_t *outL, int16_t *outR, int n);
+	audio_block_t *inputQueueArray[1];
+	comb_t combL[8];
+	comb_t combR[8];
+	allpass_t allpassL[4];
+	allpass_t allpassR[4];
+	// halfband filter history, at the lower rate for the interpolators
+	int16_t decimate_state[FREEVERB_HALFBAND_TAPS*4 - 2];
+	int16_t interpolateL_state[FREEVERB_HALFBAND_TAPS*2 - 1];
+	int16_t interpolateR_state[FREEVERB_HALFBAND_TAPS*2 - 1];
+	float damping_amount;
+	int16_t combdamp1;
+	int16_t combdamp2;
+	int16_t combfeeback;
+	bool half_rate;
+	bool ready;
+};
+
 #endif
 
@@ -0,0 +1,351 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#include <Arduino.h>
+#include "effect_granular_cloud.h"
+#include "utility/dspinst.h"
+
+// 0.5 - 0.5 * cos(2 * pi * n / 256), Q15
+static const int16_t window_hann[257] = {
+	0, 5, 20, 44, 79, 123, 177, 241, 315, 398, 491, 593,
+	705, 827, 958, 1098, 1247, 1406, 1573, 1749, 1935, 2128, 2331, 2542,
+	2761, 2989, 3224, 3468, 3719, 3978, 4244, 4518, 4799, 5086, 5381, 5682,
+	5990, 6304, 6624, 6950, 7281, 7618, 7961, 8308, 8660, 9017, 9379, 9744,
+	10114, 10487, 10864, 11244, 11628, 12014, 12403, 12794, 13187, 13583, 13980, 14378,
+	14778, 15178, 15580, 15981, 16383, 16786, 17187, 17589, 17989, 18389, 18787, 19184,
+	19580, 19973, 20364, 20753, 21139, 21523, 21903, 22280, 22653, 23023, 23388, 23750,
+	24107, 24459, 24806, 25149, 25486, 25817, 26143, 26463, 26777, 27085, 27386, 27681,
+	27968, 28249, 28523, 28789, 29048, 29299, 29543, 29778, 30006, 30225, 30436, 30639,
+	30832, 31018, 31194, 31361, 31520, 31669, 31809, 31940, 32062, 32174, 32276, 32369,
+	32452, 32526, 32590, 32644, 32688, 32723, 32747, 32762, 32767, 32762, 32747, 32723,
+	32688, 32644, 32590, 32526, 32452, 32369, 32276, 32174, 32062, 31940, 31809, 31669,
+	31520, 31361, 31194, 31018, 30832, 30639, 30436, 30225, 30006, 29778, 29543, 29299,
+	29048, 28789, 28523, 28249, 27968, 27681, 27386, 27085, 26777, 26463, 26143, 25817,
+	25486, 25149, 24806, 24459, 24107, 23750, 23388, 23023, 22653, 22280, 21903, 21523,
+	21139, 20753, 20364, 19973, 19580, 19184, 18787, 18389, 17989, 17589, 17187, 16786,
+	16384, 15981, 15580, 15178, 14778, 14378, 13980, 13583, 13187, 12794, 12403, 12014,
+	11628, 11244, 10864, 10487, 10114, 9744, 9379, 9017, 8660, 8308, 7961, 7618,
+	7281, 6950, 6624, 6304, 5990, 5682, 5381, 5086, 4799, 4518, 4244, 3978,
+	3719, 3468, 3224, 2989, 2761, 2542, 2331, 2128, 1935, 1749, 1573, 1406,
+	1247, 1098, 958, 827, 705, 593, 491, 398, 315, 241, 177, 123,
+	79, 44, 20, 5, 0,
+};
+
+// Tukey, alpha = 0.5: Hann tapers over the first and last quarter, flat between
+static const int16_t window_tukey[257] = {
+	0, 20, 79, 177, 315, 491, 705, 958, 1247, 1573, 1935, 2331,
+	2761, 3224, 3719, 4244, 4799, 5381, 5990, 6624, 7281, 7961, 8660, 9379,
+	10114, 10864, 11628, 12403, 13187, 13980, 14778, 15580, 16383, 17187, 17989, 18787,
+	19580, 20364, 21139, 21903, 22653, 23388, 24107, 24806, 25486, 26143, 26777, 27386,
+	27968, 28523, 29048, 29543, 30006, 30436, 30832, 31194, 31520, 31809, 32062, 32276,
+	32452, 32590, 32688, 32747, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32747, 32688, 32590, 32452, 32276, 32062, 31809, 31520, 31194, 30832, 30436,
+	30006, 29543, 29048, 28523, 27968, 27386, 26777, 26143, 25486, 24806, 24107, 23388,
+	22653, 21903, 21139, 20364, 19580, 18787, 17989, 17187, 16383, 15580, 14778, 13980,
+	13187, 12403, 11628, 10864, 10114, 9379, 8660, 7961, 7281, 6624, 5990, 5381,
+	4799, 4244, 3719, 3224, 2761, 2331, 1935, 1573, 1247, 958, 705, 491,
+	315, 177, 79, 20, 0,
+};
+
+AudioEffectGranularCloud::AudioEffectGranularCloud(void) : AudioStream(1, inputQueueArray)
+{
+	active = 0;
+	buffer = NULL;
+	buffer_length = 0;
+	head = 0;
+	seed = 0x6B43A9B5;
+	countdown = 0;
+	window_table = window_hann;
+	window_type = GRANULAR_WINDOW_HANN;
+	frozen = false;
+	spread_amount = 0;
+	interval = 0.0f;
+	grains_per_second = 20.0f;
+	length_ms = 100.0f;
+	position_ms = 200.0f;
+	pitch_ratio = 1.0f;
+	position_jitter_ms = 0.0f;
+	pitch_jitter_semitones = 0.0f;
+	timing_jitter = 0.0f;
+	updateScheduler();
+}
+
+bool AudioEffectGranularCloud::begin(int16_t *sample_bank, uint32_t length)
+{
+	__disable_irq();
+	buffer = NULL;
+	active = 0;
+	__enable_irq();
+	if (!sample_bank || length < AUDIO_BLOCK_SAMPLES * 4) return false;
+	memset(sample_bank, 0, length * sizeof(int16_t));
+	__disable_irq();
+	buffer = sample_bank;
+	buffer_length = length;
+	head = 0;
+	countdown = 0;
+	__enable_irq();
+	updateScheduler();
+	return true;
+}
+
+void AudioEffectGranularCloud::window(int type)
+{
+	__disable_irq();
+	if (type == GRANULAR_WINDOW_TUKEY) {
+		window_table = window_tukey;
+		window_type = GRANULAR_WINDOW_TUKEY;
+	} else {
+		window_table = window_hann;
+		window_type = GRANULAR_WINDOW_HANN;
+	}
+	__enable_irq();
+	updateScheduler();
+}
+
+void AudioEffectGranularCloud::updateScheduler(void)
+{
+	const float ms = AUDIO_SAMPLE_RATE_EXACT * 0.001f;
+	float len = length_ms * ms;
+	float maxlen = (buffer_length > 0) ? buffer_length / 4 : 65536;
+	if (len > maxlen) len = maxlen;
+	if (len < 16.0f) len = 16.0f;
+	float ivl = 0.0f;
+	if (grains_per_second > 0.0f) ivl = AUDIO_SAMPLE_RATE_EXACT / grains_per_second;
+	float tj = timing_jitter;
+	if (tj < 0.0f) tj = 0.0f;
+	else if (tj > 1.0f) tj = 1.0f;
+	float pos = position_ms * ms;
+	if (pos < 0.0f) pos = 0.0f;
+	float posj = fabsf(position_jitter_ms) * ms;
+	float pitchj = fabsf(pitch_jitter_semitones) * (1.0f / 12.0f);
+	if (pitchj > 1.0f) pitchj = 1.0f;
+
+	// Grains which start together add coherently, so the gain follows the
+	// window's mean.  Once they are scattered, their powers add instead.
+	float gain = 1.0f;
+	if (ivl > 0.0f) {
+		float overlap = len / ivl;
+		if (overlap > GRANULAR_CLOUD_MAX_GRAINS) overlap = GRANULAR_CLOUD_MAX_GRAINS;
+		bool hann = (window_type == GRANULAR_WINDOW_HANN);
+		if (posj > 0.0f || pitchj > 0.0f || tj > 0.0f) {
+			float sum = overlap * (hann ? 0.375f : 0.6875f);
+			if (sum > 1.0f) gain = 1.0f / sqrtf(sum);
+		} else {
+			float sum = overlap * (hann ? 0.5f : 0.75f);
+			if (sum > 1.0f) gain = 1.0f / sum;
+		}
+	}
+	__disable_irq();
+	if (interval == 0.0f) countdown = 0;
+	interval = ivl;
+	interval_jitter = ivl * tj;
+	grain_samples = len;
+	grain_position = pos;
+	grain_position_jitter = posj;
+	grain_pitch = pitch_ratio;
+	grain_pitch_jitter = pitchj;
+	grain_gain = gain * 32767.0f;
+	__enable_irq();
+}
+
+// Begin a new grain "offset" samples into this block.  "newest" is the
+// position in the buffer of the most recent sample at the start of the block.
+void AudioEffectGranularCloud::startGrain(uint32_t newest, uint32_t offset)
+{
+	if (active == 0xFFFFFFFF) return; // all grains busy, skip this one
+	uint32_t n = __builtin_ctz(~active);
+	grain_t *g = &grain[n];
+
+	float ratio = grain_pitch;
+	if (grain_pitch_jitter > 0.0f) {
+		ratio *= exp2f(grain_pitch_jitter * randomBipolar());
+	}
+	float len = grain_samples;
+	float pos = grain_position;
+	if (grain_position_jitter > 0.0f) {
+		pos += grain_position_jitter * randomBipolar();
+	}
+	// keep the whole grain within audio which has been recorded, and will
+	// not be overwritten before the grain ends
+	float span = len * ratio;
+	float minpos, maxpos;
+	if (frozen) {
+		minpos = span + 2.0f;
+		maxpos = (float)buffer_length - 2.0f;
+	} else {
+		newest += offset;
+		if (newest >= buffer_length) newest -= buffer_length;
+		minpos = span - len + 2.0f;
+		if (minpos < 1.0f) minpos = 1.0f;
+		maxpos = (float)buffer_length - len - 2.0f;
+	}
+	if (pos > maxpos) pos = maxpos;
+	if (pos < minpos) pos = minpos;
+	uint32_t back = pos;
+	if (back > buffer_length) back = buffer_length;
+	uint32_t index = newest + buffer_length - back;
+	if (index >= buffer_length) index -= buffer_length;
+
+	float pan = 0.0f;
+	if (spread_amount > 0) pan = randomBipolar() * (float)spread_amount * (1.0f / 65536.0f);
+	float left = (pan > 0.0f) ? 1.0f - pan : 1.0f;
+	float right = (pan < 0.0f) ? 1.0f + pan : 1.0f;
+
+	g->index = index;
+	g->fraction = 0;
+	g->step = ratio;
+	g->step_fraction = (ratio - (float)g->step) * 4294967296.0f;
+	g->phase = 0;
+	g->phase_increment = 4294967296.0f / (float)grain_samples;
+	g->remaining = grain_samples;
+	g->gain_left = left * grain_gain;
+	g->gain_right = right * grain_gain;
+	g->start = offset;
+	active |= (1u << n);
+}
+
+void AudioEffectGranularCloud::update(void)
+{
+	audio_block_t *block, *left, *right;
+	int32_t sum_left[AUDIO_BLOCK_SAMPLES];
+	int32_t sum_right[AUDIO_BLOCK_SAMPLES];
+	uint32_t i, n, newest;
+
+	block = receiveReadOnly(0);
+	if (!buffer) {
+		if (block) release(block);
+		return;
+	}
+	newest = head + buffer_length - 1;
+	if (newest >= buffer_length) newest -= buffer_length;
+	if (!frozen) {
+		// record the input, wrapping around the end of the buffer
+		uint32_t count = buffer_length - head;
+		if (count > AUDIO_BLOCK_SAMPLES) count = AUDIO_BLOCK_SAMPLES;
+		if (block) {
+			memcpy(buffer + head, block->data, count * sizeof(int16_t));
+			memcpy(buffer, block->data + count, (AUDIO_BLOCK_SAMPLES - count) * sizeof(int16_t));
+		} else {
+			memset(buffer + head, 0, count * sizeof(int16_t));
+			memset(buffer, 0, (AUDIO_BLOCK_SAMPLES - count) * sizeof(int16_t));
+		}
+		newest = head;
+		head += AUDIO_BLOCK_SAMPLES;
+		if (head >= buffer_length) head -= buffer_length;
+	}
+	if (block) release(block);
+
+	// schedule the grains which begin during this block
+	if (interval > 0.0f) {
+		while (countdown < AUDIO_BLOCK_SAMPLES) {
+			startGrain(newest, countdown);
+			float ivl = interval;
+			if (interval_jitter > 0.0f) ivl += interval_jitter * randomBipolar();
+			countdown += (ivl >= 1.0f) ? (int32_t)(ivl + 0.5f) : 1;
+		}
+		countdown -= AUDIO_BLOCK_SAMPLES;
+	}
+	if (!active) return;
+
+	memset(sum_left, 0, sizeof(sum_left));
+	memset(sum_right, 0, sizeof(sum_right));
+	const int16_t *data = buffer;
+	const int16_t *win = window_table;
+	const uint32_t len = buffer_length;
+	uint32_t mask = active;
+	while (mask) {
+		n = __builtin_ctz(mask);
+		mask &= ~(1u << n);
+		grain_t *g = &grain[n];
+		uint32_t index = g->index;
+		uint32_t fraction = g->fraction;
+		uint32_t phase = g->phase;
+		const uint32_t step = g->step;
+		const uint32_t step_fraction = g->step_fraction;
+		const uint32_t phase_increment = g->phase_increment;
+		const int32_t gain_left = g->gain_left;
+		const int32_t gain_right = g->gain_right;
+		uint32_t count = AUDIO_BLOCK_SAMPLES - g->start;
+		if (count > g->remaining) count = g->remaining;
+		int32_t *pl = sum_left + g->start;
+		int32_t *pr = sum_right + g->start;
+		for (i=0; i < count; i++) {
+			uint32_t next = index + 1;
+			if (next >= len) next = 0;
+			int32_t s0 = data[index];
+			int32_t s = s0 + (((data[next] - s0) * (int32_t)(fraction >> 17)) >> 15);
+			uint32_t w_index = phase >> 24;
+			int32_t w0 = win[w_index];
+			int32_t w = w0 + (((win[w_index + 1] - w0) * (int32_t)((phase >> 9) & 0x7FFF)) >> 15);
+			int32_t val = (s * w) >> 15;
+			*pl++ += (val * gain_left) >> 15;
+			*pr++ += (val * gain_right) >> 15;
+			phase += phase_increment;
+			uint32_t f = fraction + step_fraction;
+			index += step + (f < fraction);
+			fraction = f;
+			if (index >= len) index -= len;
+		}
+		g->remaining -= count;
+		if (g->remaining == 0) {
+			active &= ~(1u << n);
+		} else {
+			g->index = index;
+			g->fraction = fraction;
+			g->phase = phase;
+			g->start = 0;
+		}
+	}
+
+	left = allocate();
+	if (left) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			left->data[i] = saturate16(sum_left[i]);
+		}
+		transmit(left, 0);
+		release(left);
+	}
+	right = allocate();
+	if (right) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			right->data[i] = saturate16(sum_right[i]);
+		}
+		transmit(right, 1);
+		release(right);
+	}
+}
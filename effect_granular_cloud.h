@@ -0,0 +1,158 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#ifndef effect_granular_cloud_h_
+#define effect_granular_cloud_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Granular cloud.  The input is recorded continuously into a circular buffer,
+// which may be very large (EXTMEM).  A scheduler starts new grains at the
+// requested density, each reading the buffer some distance behind the record
+// position, at its own pitch and with its own place in the stereo field.  Up
+// to 32 grains overlap, each shaped by a Hann or Tukey window looked up from
+// a precomputed table.  Intended for Teensy 4.x.
+
+#define GRANULAR_CLOUD_MAX_GRAINS 32
+
+#define GRANULAR_WINDOW_HANN  0
+#define GRANULAR_WINDOW_TUKEY 1
+
+class AudioEffectGranularCloud : public AudioStream
+{
+public:
+	AudioEffectGranularCloud(void);
+	// grain memory, in any RAM including EXTMEM
+	bool begin(int16_t *sample_bank, uint32_t length);
+	virtual void update(void);
+
+	// new grains started per second, 0 to 2000
+	void density(float grainsPerSecond) {
+		if (grainsPerSecond < 0.0f) grainsPerSecond = 0.0f;
+		else if (grainsPerSecond > 2000.0f) grainsPerSecond = 2000.0f;
+		grains_per_second = grainsPerSecond;
+		updateScheduler();
+	}
+	// length of each grain
+	void grainLength(float milliseconds) {
+		length_ms = milliseconds;
+		updateScheduler();
+	}
+	// how far behind the incoming audio the grains begin reading
+	void position(float milliseconds) {
+		position_ms = milliseconds;
+		updateScheduler();
+	}
+	// playback speed of the grains, 0.25 to 4.0
+	void pitch(float ratio) {
+		if (ratio < 0.25f) ratio = 0.25f;
+		else if (ratio > 4.0f) ratio = 4.0f;
+		pitch_ratio = ratio;
+		updateScheduler();
+	}
+	// random variation of each grain's position (+/- milliseconds) and
+	// pitch (+/- semitones), and of the time between grains (0 to 1)
+	void jitter(float positionMilliseconds, float pitchSemitones, float timing = 0.0f) {
+		position_jitter_ms = positionMilliseconds;
+		pitch_jitter_semitones = pitchSemitones;
+		timing_jitter = timing;
+		updateScheduler();
+	}
+	// 0 = all grains in the centre, 1 = randomly placed from left to right
+	void spread(float amount) {
+		if (amount < 0.0f) amount = 0.0f;
+		else if (amount > 1.0f) amount = 1.0f;
+		__disable_irq();
+		spread_amount = amount * 65536.0f;
+		__enable_irq();
+	}
+	// GRANULAR_WINDOW_HANN or GRANULAR_WINDOW_TUKEY (flat top)
+	void window(int type);
+	// stop recording, so the grains keep reading the same audio
+	void freeze(bool on) {
+		__disable_irq();
+		frozen = on;
+		__enable_irq();
+	}
+private:
+	struct grain_t {
+		uint32_t index;        // buffer position, whole samples
+		uint32_t fraction;     // buffer position, fraction of a sample
+		uint32_t step;         // whole samples per output sample
+		uint32_t step_fraction;
+		uint32_t phase;        // window position
+		uint32_t phase_increment;
+		uint32_t remaining;    // output samples until the grain ends
+		int16_t gain_left;     // Q15
+		int16_t gain_right;
+		uint16_t start;        // first sample in the current block
+	};
+	void updateScheduler(void);
+	void startGrain(uint32_t newest, uint32_t offset);
+	uint32_t randomNumber(void) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		return seed;
+	}
+	// random float from -1.0 to +1.0
+	float randomBipolar(void) {
+		return (float)(int32_t)randomNumber() * (1.0f / 2147483648.0f);
+	}
+	audio_block_t *inputQueueArray[1];
+	grain_t grain[GRANULAR_CLOUD_MAX_GRAINS];
+	uint32_t active;               // bitmask of grains playing
+	int16_t *buffer;
+	uint32_t buffer_length;
+	uint32_t head;
+	uint32_t seed;
+	int32_t countdown;             // samples until the next grain
+	const int16_t *window_table;
+	bool frozen;
+	// scheduler, in samples, set from the parameters below
+	float interval;                // 0 when no grains are started
+	float interval_jitter;
+	uint32_t grain_samples;
+	float grain_position;
+	float grain_position_jitter;
+	float grain_pitch;
+	float grain_pitch_jitter;      // octaves
+	int16_t grain_gain;            // Q15, for roughly constant loudness
+	int32_t spread_amount;         // Q16
+	float grains_per_second;
+	float length_ms;
+	float position_ms;
+	float pitch_ratio;
+	float position_jitter_ms;
+	float pitch_jitter_semitones;
+	float timing_jitter;
+	uint8_t window_type;
+};
+
+#endif
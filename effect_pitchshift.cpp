@@ -0,0 +1,490 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#include <Arduino.h>
+#include "effect_pitchshift.h"
+#include "utility/dspinst.h"
+
+extern "C" {
+extern const int16_t AudioWaveformSine[257];
+}
+
+// for each quality level: FFT size, and longest period PSOLA will find
+static const uint16_t fft_sizes[4] = {256, 512, 1024, 2048};
+static const uint16_t psola_periods[4] = {294, 441, 630, 882}; // 150, 100, 70, 50 Hz
+
+#define PSOLA_MIN_PERIOD       44  // 1000 Hz
+#define PSOLA_UNVOICED_PERIOD  220 // grain spacing when no pitch is found
+#define PSOLA_DECIMATE         4
+
+AudioEffectPitchShift::AudioEffectPitchShift(void) : AudioStream(1, inputQueueArray)
+{
+	pitch_ratio = 1.0f;
+	formant_ratio = 1.0f;
+	method_setting = PITCHSHIFT_PSOLA;
+	quality_level = 1;
+	vocoder_memory = NULL;
+	vocoder_length = 0;
+	configuring = false;
+	configure(PITCHSHIFT_PSOLA, 1);
+}
+
+void AudioEffectPitchShift::configure(int method, int level)
+{
+	if (level < 0) level = 0;
+	else if (level > 3) level = 3;
+	if (method != PITCHSHIFT_VOCODER) method = PITCHSHIFT_PSOLA;
+	// update() passes nothing while the buffers are rebuilt, so the
+	// slow work below runs with interrupts enabled.  An update already
+	// running finishes before this continues, because it interrupts
+	// this code.
+	__disable_irq();
+	configuring = true;
+	method_setting = method;
+	quality_level = level;
+	__enable_irq();
+	// the largest FFT, up to the quality's size, the memory holds
+	int fft_level = level;
+	while (fft_level > 0 && PITCHSHIFT_VOCODER_MEMORY(fft_sizes[fft_level]) > vocoder_length) fft_level--;
+	if (PITCHSHIFT_VOCODER_MEMORY(fft_sizes[fft_level]) > vocoder_length) method = PITCHSHIFT_PSOLA;
+	bool active = false;
+	uint32_t latency;
+	if (method == PITCHSHIFT_VOCODER) {
+		const uint32_t N = fft_sizes[fft_level];
+		const uint32_t bins = N / 2 + 1;
+		float *p = vocoder_memory;
+		memset(p, 0, PITCHSHIFT_VOCODER_MEMORY(N) * sizeof(float));
+		vocoder.input = p;        p += N;
+		vocoder.output = p;       p += N;
+		vocoder.work = p;         p += N + 2;
+		vocoder.spectrum = p;     p += N;
+		vocoder.window = p;       p += bins;
+		vocoder.last_phase = p;   p += bins;
+		vocoder.sum_phase = p;    p += bins;
+		vocoder.magnitude = p;    p += bins;
+		vocoder.phase = p;        p += bins;
+		vocoder.envelope = p;     p += bins;
+		vocoder.peak = (uint16_t *)p;
+		vocoder.fill = 0;
+		fft_size = N;
+		arm_rfft_fast_init_f32(&fft_inst, fft_size);
+		// periodic Hann, only the first half is stored
+		for (uint32_t i=0; i <= fft_size / 2; i++) {
+			float s = sinf((float)M_PI * (float)i / (float)fft_size);
+			vocoder.window[i] = s * s;
+		}
+		latency = fft_size;
+		active = true;
+	} else {
+		memset(&psola, 0, sizeof(psola));
+		max_period = psola_periods[level];
+		latency = max_period * 2;
+	}
+	__disable_irq();
+	psola_period = 0.0f;
+	latency_samples = latency;
+	vocoder_active = active;
+	configuring = false;
+	__enable_irq();
+}
+
+void AudioEffectPitchShift::update(void)
+{
+	audio_block_t *block;
+	float in[AUDIO_BLOCK_SAMPLES], out[AUDIO_BLOCK_SAMPLES];
+	uint32_t i;
+
+	block = receiveReadOnly(0);
+	if (configuring) {
+		if (block) release(block);
+		return;
+	}
+	if (block) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			in[i] = (float)block->data[i] * (1.0f / 32768.0f);
+		}
+		release(block);
+	} else {
+		memset(in, 0, sizeof(in));
+	}
+	if (vocoder_active) {
+		updateVocoder(in, out);
+	} else {
+		updatePSOLA(in, out);
+	}
+	block = allocate();
+	if (!block) return;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		block->data[i] = saturate16((int32_t)(out[i] * 32768.0f));
+	}
+	transmit(block);
+	release(block);
+}
+
+/******************************************************************/
+//                     FFT phase vocoder
+
+void AudioEffectPitchShift::updateVocoder(const float *in, float *out)
+{
+	const uint32_t N = fft_size;
+	const uint32_t hop = N / 4;
+	uint32_t pos = 0;
+
+	// Each input sample goes into the newest hop of the analysis frame, and
+	// each output sample comes from the oldest hop of the overlap-add, which
+	// every frame that will touch it has already been added to.
+	while (pos < AUDIO_BLOCK_SAMPLES) {
+		uint32_t n = hop - vocoder.fill;
+		if (n > AUDIO_BLOCK_SAMPLES - pos) n = AUDIO_BLOCK_SAMPLES - pos;
+		memcpy(vocoder.input + N - hop + vocoder.fill, in + pos, n * sizeof(float));
+		memcpy(out + pos, vocoder.output + vocoder.fill, n * sizeof(float));
+		vocoder.fill += n;
+		pos += n;
+		if (vocoder.fill >= hop) {
+			processFrame();
+			vocoder.fill = 0;
+		}
+	}
+}
+
+void AudioEffectPitchShift::processFrame(void)
+{
+	const uint32_t N = fft_size;
+	const uint32_t half = N / 2;
+	const uint32_t hop = N / 4;
+	const float expect = (float)M_PI * 0.5f; // phase advance of bin 1 per hop
+	const float twopi = 2.0f * (float)M_PI;
+	float *input = vocoder.input;
+	float *output = vocoder.output;
+	float *work = vocoder.work;
+	float *spectrum = vocoder.spectrum;
+	const float *window = vocoder.window;
+	float *analysis_phase = work + half + 1;  // the FFT has finished with work[]
+	float *analysis_magnitude = work;
+	float *magnitude = vocoder.magnitude;
+	float *phase = vocoder.phase;
+	uint16_t *peak = vocoder.peak;
+	uint32_t i, k, count;
+
+	float ratio = pitch_ratio;
+	float formant = formant_ratio;
+	if (formant == 0.0f) formant = ratio;
+
+	for (i=0; i < half; i++) {
+		work[i] = input[i] * window[i];
+		work[N - 1 - i] = input[N - 1 - i] * window[i + 1];
+	}
+	memmove(input, input + hop, (N - hop) * sizeof(float));
+	arm_rfft_fast_f32(&fft_inst, work, spectrum, 0);
+
+	float largest = 0.0f;
+	for (k=0; k <= half; k++) {
+		float re, im;
+		if (k == 0) {
+			re = spectrum[0];
+			im = 0.0f;
+		} else if (k == half) {
+			re = spectrum[1];
+			im = 0.0f;
+		} else {
+			re = spectrum[k * 2];
+			im = spectrum[k * 2 + 1];
+		}
+		float mag = sqrtf(re * re + im * im);
+		analysis_magnitude[k] = mag;
+		analysis_phase[k] = atan2f(im, re);
+		if (mag > largest) largest = mag;
+	}
+
+	// Shift each spectral peak, together with the bins around it, by a whole
+	// number of bins, so the shape of the window's main lobe is kept.  The
+	// peak's phase advances at its new frequency (found from its phase change
+	// since the last frame), and the bins around it keep their phase relative
+	// to the peak (identity phase locking, Laroche and Dolson).
+	count = 0;
+	float floor_level = largest * 1.0e-4f; // -80 dB
+	for (k=1; k < half; k++) {
+		float mag = analysis_magnitude[k];
+		if (mag > floor_level && mag > analysis_magnitude[k - 1]
+		  && mag >= analysis_magnitude[k + 1]) {
+			peak[count++] = k;
+		}
+	}
+	memset(magnitude, 0, (half + 1) * sizeof(float));
+	memset(phase, 0, (half + 1) * sizeof(float));
+	uint32_t lo = 0;
+	for (i=0; i < count; i++) {
+		uint32_t p = peak[i];
+		// this peak's bins reach to the lowest bin before the next peak
+		uint32_t hi = half;
+		if (i + 1 < count) {
+			hi = p;
+			for (k=p + 1; k < peak[i + 1]; k++) {
+				if (analysis_magnitude[k] < analysis_magnitude[hi]) hi = k;
+			}
+			if (hi == p) hi = peak[i + 1] - 1;
+		}
+		float delta = analysis_phase[p] - vocoder.last_phase[p] - (float)p * expect;
+		delta -= twopi * floorf(delta * (1.0f / twopi) + 0.5f);
+		float freq = (float)p + delta * (1.0f / expect);
+		int32_t shift = (int32_t)floorf(freq * (ratio - 1.0f) + 0.5f);
+		int32_t target = (int32_t)p + shift;
+		if (target > (int32_t)half) break;
+		freq *= ratio;
+		float peak_phase = vocoder.sum_phase[target] + freq * expect;
+		peak_phase -= twopi * floorf(peak_phase * (1.0f / twopi) + 0.5f);
+		for (k=lo; k <= hi; k++) {
+			int32_t n = (int32_t)k + shift;
+			if (n < 0) continue;
+			if (n > (int32_t)half) break;
+			float mag = analysis_magnitude[k];
+			// where regions overlap after shifting down, the louder wins
+			if (mag > magnitude[n]) {
+				magnitude[n] = mag;
+				phase[n] = peak_phase + analysis_phase[k] - analysis_phase[p];
+			}
+		}
+		lo = hi + 1;
+	}
+	memcpy(vocoder.last_phase, analysis_phase, (half + 1) * sizeof(float));
+	memcpy(vocoder.sum_phase, phase, (half + 1) * sizeof(float));
+
+	// formants: the spectral envelope is the magnitude smoothed over about
+	// 500 Hz.  Each shifted bin is scaled from the envelope it brought with it
+	// to the envelope wanted at its new frequency.
+	if (formant != ratio) {
+		float *envelope = vocoder.envelope;
+		int32_t r = (int32_t)(250.0f * (float)N / AUDIO_SAMPLE_RATE_EXACT);
+		if (r < 1) r = 1;
+		float sum = 0.0f;
+		for (k=0; k < (uint32_t)r && k <= half; k++) sum += analysis_magnitude[k];
+		for (int32_t n=0; n <= (int32_t)half; n++) {
+			if (n + r <= (int32_t)half) sum += analysis_magnitude[n + r];
+			if (n - r - 1 >= 0) sum -= analysis_magnitude[n - r - 1];
+			int32_t first = (n - r < 0) ? 0 : n - r;
+			int32_t last = (n + r > (int32_t)half) ? half : n + r;
+			envelope[n] = sum / (float)(last - first + 1) + 1.0e-9f;
+		}
+		for (k=1; k <= half; k++) {
+			if (magnitude[k] == 0.0f) continue;
+			float want = (float)k / formant;
+			float have = (float)k / ratio;
+			if (want >= (float)half) {
+				magnitude[k] = 0.0f;
+				continue;
+			}
+			uint32_t a = want;
+			uint32_t b = have;
+			if (b >= half) b = half - 1;
+			float ea = envelope[a] + (envelope[a + 1] - envelope[a]) * (want - (float)a);
+			float eb = envelope[b] + (envelope[b + 1] - envelope[b]) * (have - (float)b);
+			float scale = ea / eb;
+			if (scale > 8.0f) scale = 8.0f;
+			magnitude[k] *= scale;
+		}
+	}
+
+	spectrum[0] = magnitude[0] * cosf(phase[0]);
+	spectrum[1] = magnitude[half] * cosf(phase[half]);
+	for (k=1; k < half; k++) {
+		spectrum[k * 2] = magnitude[k] * cosf(phase[k]);
+		spectrum[k * 2 + 1] = magnitude[k] * sinf(phase[k]);
+	}
+	arm_rfft_fast_f32(&fft_inst, spectrum, work, 1);
+
+	// overlap-add, the squared Hann windows at 4 times overlap sum to 1.5
+	memmove(output, output + hop, (N - hop) * sizeof(float));
+	memset(output + N - hop, 0, hop * sizeof(float));
+	const float scale = 1.0f / 1.5f;
+	for (i=0; i < half; i++) {
+		output[i] += work[i] * window[i] * scale;
+		output[N - 1 - i] += work[N - 1 - i] * window[i + 1] * scale;
+	}
+}
+
+/******************************************************************/
+//                           PSOLA
+
+// Hann window, 1.0 at x = 0 falling to 0 at x = -1 and +1
+static inline float hann(float x)
+{
+	// 0.5 + 0.5 * cos(pi * x), from the sine table
+	float index = x * 128.0f + 64.0f;
+	if (index < 0.0f) index += 256.0f;
+	uint32_t i = index;
+	float frac = index - (float)i;
+	float s = (float)AudioWaveformSine[i] + (float)(AudioWaveformSine[i + 1] - AudioWaveformSine[i]) * frac;
+	return 0.5f + s * (0.5f / 32767.0f);
+}
+
+void AudioEffectPitchShift::updatePSOLA(const float *in, float *out)
+{
+	const int32_t mask = PITCHSHIFT_PSOLA_SIZE - 1;
+	float *input = psola.input;
+	float *output = psola.output;
+	uint32_t i;
+
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		input[(psola.head + i) & mask] = in[i];
+	}
+	psola.head = (psola.head + AUDIO_BLOCK_SAMPLES) & mask;
+	psola.synthesis += AUDIO_BLOCK_SAMPLES;
+	psola.mark += AUDIO_BLOCK_SAMPLES;
+	const int32_t head = psola.head;
+	const float latency = latency_samples;
+
+	float period = findPeriod();
+	psola_period = period;
+	float ratio = pitch_ratio;
+	float formant = formant_ratio;
+	if (formant == 0.0f) formant = ratio;
+	if (period == 0.0f) {
+		// unvoiced, overlap grains at a fixed spacing without shifting
+		period = (max_period < PSOLA_UNVOICED_PERIOD) ? max_period : PSOLA_UNVOICED_PERIOD;
+		ratio = 1.0f;
+	}
+
+	// Place every grain whose input has arrived.  All positions are counted
+	// in samples before the newest input.  Each grain is two periods of the
+	// input, centred on the latest analysis mark (spaced one period apart)
+	// at or before the grain's centre, and is resampled to move the formants.
+	while (psola.synthesis >= period + 1.0f) {
+		const float centre = psola.synthesis;
+		while (psola.mark - period >= centre) psola.mark -= period;
+		if (psola.mark < centre) psola.mark = centre;
+		// a whole number of samples from the centre, so without a formant
+		// change the input is read without interpolation
+		const float mark = centre + floorf(psola.mark - centre + 0.5f);
+		float length = period / formant; // half the grain, in output samples
+		if (length > latency - period) length = latency - period;
+		const float scale = 1.0f / length;
+		int32_t first = floorf(centre + length);
+		int32_t last = ceilf(centre - length);
+		for (int32_t n = first; n >= last; n--) {
+			float t = centre - (float)n;
+			float pos = (float)head - (mark - t * formant);
+			float ip = floorf(pos);
+			float frac = pos - ip;
+			int32_t j = (int32_t)ip;
+			float x = input[j & mask] + (input[(j + 1) & mask] - input[j & mask]) * frac;
+			output[(head - n) & mask] += x * hann(t * scale);
+		}
+		psola.synthesis -= period / ratio;
+	}
+
+	// output the audio which every grain has been added to
+	int32_t start = head - (int32_t)latency_samples - AUDIO_BLOCK_SAMPLES;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		int32_t j = (start + i) & mask;
+		out[i] = output[j];
+		output[j] = 0.0f;
+	}
+}
+
+// Find the period of the newest input, using the cumulative mean normalized
+// difference (YIN).  A coarse search on the input decimated by 4 is refined
+// at the full rate.  Returns 0 when there is no clear period.
+float AudioEffectPitchShift::findPeriod(void)
+{
+	const int32_t mask = PITCHSHIFT_PSOLA_SIZE - 1;
+	const float *input = psola.input;
+	const int32_t head = psola.head;
+	const uint32_t window = max_period;
+	const uint32_t M = window / PSOLA_DECIMATE;
+	const uint32_t maxlag = max_period / PSOLA_DECIMATE;
+	const uint32_t minlag = PSOLA_MIN_PERIOD / PSOLA_DECIMATE;
+	float *dec = psola.decimated;
+	float *diff = psola.difference;
+	uint32_t i, j, tau;
+
+	float energy = 0.0f;
+	for (i=0; i < M + maxlag; i++) {
+		int32_t n = head - 1 - (int32_t)(i * PSOLA_DECIMATE);
+		// triangular lowpass before keeping every 4th sample
+		float sum = input[n & mask] + input[(n - 6) & mask]
+			+ 2.0f * (input[(n - 1) & mask] + input[(n - 5) & mask])
+			+ 3.0f * (input[(n - 2) & mask] + input[(n - 4) & mask])
+			+ 4.0f * input[(n - 3) & mask];
+		dec[i] = sum;
+		if (i < M) energy += sum * sum;
+	}
+	if (energy < (float)M * 2.56e-4f) return 0.0f; // below -60 dB
+
+	float running = 0.0f;
+	for (tau=1; tau <= maxlag; tau++) {
+		float d = 0.0f;
+		for (j=0; j < M; j++) {
+			float v = dec[j] - dec[j + tau];
+			d += v * v;
+		}
+		running += d;
+		diff[tau] = (running > 0.0f) ? d * (float)tau / running : 1.0f;
+	}
+	// The deepest dip must be clear enough, but the first dip nearly as deep
+	// is taken, because multiples of the period dip as well.  The coarse lags
+	// can miss the period by half a sample, so the margin is generous.
+	float deepest = 0.35f;
+	for (tau=minlag; tau <= maxlag; tau++) {
+		if (diff[tau] < deepest) deepest = diff[tau];
+	}
+	if (deepest >= 0.35f) return 0.0f;
+	uint32_t found = 0;
+	for (tau=minlag; tau <= maxlag; tau++) {
+		if (diff[tau] <= deepest + 0.25f) {
+			while (tau < maxlag && diff[tau + 1] < diff[tau]) tau++;
+			found = tau;
+			break;
+		}
+	}
+
+	// refine at the full sample rate, near the coarse result
+	int32_t lo = found * PSOLA_DECIMATE - PSOLA_DECIMATE;
+	int32_t hi = found * PSOLA_DECIMATE + PSOLA_DECIMATE;
+	if (lo < PSOLA_MIN_PERIOD) lo = PSOLA_MIN_PERIOD;
+	if (hi > (int32_t)max_period) hi = max_period;
+	float d[2 * PSOLA_DECIMATE + 1];
+	int32_t best = lo;
+	for (int32_t t = lo; t <= hi; t++) {
+		float sum = 0.0f;
+		for (j=0; j < window; j++) {
+			int32_t n = head - 1 - (int32_t)j;
+			float v = input[n & mask] - input[(n - t) & mask];
+			sum += v * v;
+		}
+		d[t - lo] = sum;
+		if (sum < d[best - lo]) best = t;
+	}
+	float period = best;
+	if (best > lo && best < hi) {
+		// parabolic interpolation between the neighbouring lags
+		float a = d[best - lo - 1], b = d[best - lo], c = d[best - lo + 1];
+		float denom = a - 2.0f * b + c;
+		if (denom > 0.0f) period += 0.5f * (a - c) / denom;
+	}
+	return period;
+}
@@ -0,0 +1,158 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#ifndef effect_pitchshift_h_
+#define effect_pitchshift_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include <arm_math.h>    // github.com/PaulStoffregen/cores/blob/master/teensy4/arm_math.h
+
+// Pitch and formant shifter, with two methods:
+//
+// PITCHSHIFT_PSOLA follows the period of the input and overlaps two period
+// long grains at the new pitch (time domain pitch synchronous overlap-add).
+// Formants stay in place, so it suits a single voice or instrument.
+//
+// PITCHSHIFT_VOCODER is an FFT phase vocoder, with 4 times overlap, which
+// moves every frequency in the spectrum, so it also works with chords and
+// mixed material.  The spectral envelope is estimated to keep or move the
+// formants.
+//
+// quality() trades latency for the lowest frequency handled well.  The
+// vocoder's buffers are given by begin(), so an object used only for PSOLA
+// does not reserve them.  Intended for Teensy 4.x.
+
+#define PITCHSHIFT_PSOLA   0
+#define PITCHSHIFT_VOCODER 1
+
+#define PITCHSHIFT_MAX_FFT     2048
+#define PITCHSHIFT_PSOLA_SIZE  4096 // must be a power of 2
+#define PITCHSHIFT_PSOLA_MAX_PERIOD 882 // 50 Hz
+// floats of memory PITCHSHIFT_VOCODER needs for an FFT size, 256 to 2048
+#define PITCHSHIFT_VOCODER_MEMORY(fft_size) ((fft_size) * 57u / 8 + 8)
+
+class AudioEffectPitchShift : public AudioStream
+{
+public:
+	AudioEffectPitchShift(void);
+	virtual void update(void);
+
+	// memory for PITCHSHIFT_VOCODER, PITCHSHIFT_VOCODER_MEMORY(fft_size)
+	// floats for the FFT size of the quality used.  With less, the largest
+	// FFT size that fits is used.  Without enough for 256, the vocoder mode
+	// plays as PSOLA.
+	void begin(float *memory, uint32_t length) {
+		__disable_irq();
+		vocoder_memory = memory;
+		vocoder_length = memory ? length : 0;
+		__enable_irq();
+		configure(method_setting, quality_level);
+	}
+
+	// PITCHSHIFT_PSOLA or PITCHSHIFT_VOCODER
+	void mode(int method) {
+		configure(method, quality_level);
+	}
+	// 0 to 3, higher quality has more latency
+	void quality(int level) {
+		configure(method_setting, level);
+	}
+	// pitch change, 0.5 to 2.0
+	void pitch(float ratio) {
+		if (ratio < 0.5f) ratio = 0.5f;
+		else if (ratio > 2.0f) ratio = 2.0f;
+		pitch_ratio = ratio;
+	}
+	void semitones(float n) {
+		pitch(powf(2.0f, n * (1.0f / 12.0f)));
+	}
+	// formant change, 0.5 to 2.0, or 0 to move with the pitch
+	void formant(float ratio) {
+		if (ratio <= 0.0f) ratio = 0.0f;
+		else if (ratio < 0.5f) ratio = 0.5f;
+		else if (ratio > 2.0f) ratio = 2.0f;
+		formant_ratio = ratio;
+	}
+	// delay from input to output, in milliseconds
+	float latency(void) {
+		return (float)latency_samples * (1000.0f / AUDIO_SAMPLE_RATE_EXACT);
+	}
+	// the input's period found by PSOLA, in Hz, or 0 if unvoiced
+	float frequency(void) {
+		float p = psola_period;
+		return (p > 0.0f) ? AUDIO_SAMPLE_RATE_EXACT / p : 0.0f;
+	}
+private:
+	void configure(int method, int level);
+	void updatePSOLA(const float *in, float *out);
+	void updateVocoder(const float *in, float *out);
+	void processFrame(void);
+	float findPeriod(void);
+	struct vocoder_t {   // in the memory from begin()
+		float *input;       // most recent input, one frame
+		float *output;      // overlap-add of synthesis frames
+		float *work;        // fft_size + 2
+		float *spectrum;
+		float *window;      // fft_size / 2 + 1, as are the rest
+		float *last_phase;
+		float *sum_phase;
+		float *magnitude;   // shifted
+		float *phase;       // shifted
+		float *envelope;
+		uint16_t *peak;     // fft_size / 4
+		uint32_t fill;      // input samples since the last frame
+	};
+	struct psola_t {
+		float input[PITCHSHIFT_PSOLA_SIZE];  // circular
+		float output[PITCHSHIFT_PSOLA_SIZE]; // circular, same time as input
+		uint32_t head;     // index of the next input sample
+		float synthesis;   // next output grain centre, samples ago
+		float mark;        // analysis mark for that grain, samples ago
+		float decimated[PITCHSHIFT_PSOLA_MAX_PERIOD / 2 + 1]; // period search
+		float difference[PITCHSHIFT_PSOLA_MAX_PERIOD / 4 + 1];
+	};
+	vocoder_t vocoder;
+	psola_t psola;
+	float *vocoder_memory;
+	uint32_t vocoder_length;
+	arm_rfft_fast_instance_f32 fft_inst;
+	uint32_t fft_size;
+	uint32_t max_period;       // PSOLA, longest period detected
+	uint32_t latency_samples;
+	volatile float psola_period;
+	volatile float pitch_ratio;
+	volatile float formant_ratio;
+	uint8_t method_setting;
+	bool vocoder_active;       // false if PSOLA, or the vocoder has no memory
+	volatile bool configuring; // configure() is rebuilding the buffers
+	uint8_t quality_level;
+	audio_block_t *inputQueueArray[1];
+};
+
+#endif
@@ -0,0 +1,318 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#include <Arduino.h>
+#include "effect_reverb_fdn.h"
+#include "utility/dspinst.h"
+
+extern "C" {
+extern const int16_t AudioWaveformSine[257];
+}
+
+#define MOD_MARGIN     48  // room for 1 ms of modulation, and interpolation
+#define SHORTEST       (AUDIO_BLOCK_SAMPLES + 2 + MOD_MARGIN)
+#define STORAGE_SCALE  16384.0f // 6 dB of headroom in the 16 bit lines
+
+// lengths of the lines relative to the longest, spaced evenly on a log scale
+static float lineRatio(uint32_t i, uint32_t lines)
+{
+	return powf(0.3f, 1.0f - (float)i / (float)(lines - 1));
+}
+
+static bool isPrime(uint32_t n)
+{
+	if (n < 2) return false;
+	if ((n & 1) == 0) return n == 2;
+	for (uint32_t d=3; d * d <= n; d += 2) {
+		if (n % d == 0) return false;
+	}
+	return true;
+}
+
+// input diffusion allpass lengths (Dattorro's, scaled to 44.1 kHz) and gains
+static const uint16_t diffuser_length[4] = {210, 159, 562, 410};
+static const float diffuser_gain[4] = {0.75f, 0.75f, 0.625f, 0.625f};
+
+// +1 or -1, an element of the Hadamard matrix, used to give the input and
+// both outputs different (orthogonal) sign patterns across the lines
+static inline float hadamardSign(uint32_t row, uint32_t column)
+{
+	return (__builtin_popcount(row & column) & 1) ? -1.0f : 1.0f;
+}
+
+AudioEffectReverbFDN::AudioEffectReverbFDN(void) : AudioStream(1, inputQueueArray)
+{
+	num_lines = 0;
+	lfo_phase = 0;
+	lfo_increment = 0;
+	mod_depth = 0.0f;
+	room_size = 0.5f;
+	reverb_time = 2.0f;
+	damping_amount = 0.5f;
+	matrix_type = REVERB_FDN_HADAMARD;
+	ramp_reset = true;
+	memset(diffuser, 0, sizeof(diffuser));
+	memset(diffuser_index, 0, sizeof(diffuser_index));
+}
+
+bool AudioEffectReverbFDN::begin(int16_t *memory, uint32_t length, int lines)
+{
+	__disable_irq();
+	num_lines = 0;
+	__enable_irq();
+	if (lines != 16) lines = 8;
+	if (!memory) return false;
+	// each line's share of the memory is in proportion to its length
+	float total = 0.0f;
+	for (int i=0; i < lines; i++) total += lineRatio(i, lines);
+	float shortest = (float)length / total * lineRatio(0, lines);
+	if (shortest < SHORTEST + 2) return false;
+	memset(memory, 0, length * sizeof(int16_t));
+	__disable_irq();
+	int16_t *p = memory;
+	for (int i=0; i < lines; i++) {
+		uint32_t len = (float)length / total * lineRatio(i, lines);
+		line[i].buffer = p;
+		line[i].length = len;
+		line[i].index = 0;
+		line[i].filter = 0.0f;
+		p += len;
+	}
+	num_lines = lines;
+	ramp_reset = true;
+	__enable_irq();
+	updateLines();
+	return true;
+}
+
+void AudioEffectReverbFDN::modulation(float milliseconds, float hz)
+{
+	float depth = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+	if (depth < 0.0f) depth = 0.0f;
+	else if (depth > MOD_MARGIN - 4) depth = MOD_MARGIN - 4;
+	if (hz < 0.0f) hz = 0.0f;
+	else if (hz > 10.0f) hz = 10.0f;
+	uint32_t n = hz * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT) * AUDIO_BLOCK_SAMPLES;
+	__disable_irq();
+	mod_depth = depth;
+	lfo_increment = n;
+	__enable_irq();
+}
+
+void AudioEffectReverbFDN::updateLines(void)
+{
+	float base[REVERB_FDN_MAX_LINES], gain[REVERB_FDN_MAX_LINES], damp[REVERB_FDN_MAX_LINES];
+	const uint32_t lines = num_lines;
+	if (lines == 0) return;
+
+	// the longest line, limited by the memory given to each line
+	float longest = (20.0f + 80.0f * room_size) * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+	for (uint32_t i=0; i < lines; i++) {
+		float n = (float)(line[i].length - MOD_MARGIN) / lineRatio(i, lines);
+		if (longest > n) longest = n;
+	}
+	// Jot's absorption: the gain and lowpass of each line are chosen from
+	// its length, for the low and high frequency decay times
+	const float samples = reverb_time * AUDIO_SAMPLE_RATE_EXACT;
+	const float high = 1.0f - 0.9f * damping_amount;
+	uint32_t prev = 0;
+	for (uint32_t i=0; i < lines; i++) {
+		uint32_t max = line[i].length - MOD_MARGIN;
+		uint32_t n = longest * lineRatio(i, lines);
+		if (n < SHORTEST) n = SHORTEST;
+		if (n <= prev) n = prev + 1;
+		uint32_t d = n;
+		while (!isPrime(d) && d < max) d++;
+		if (!isPrime(d)) {
+			for (d = n; d > prev + 1 && !isPrime(d); d--) ;
+		}
+		prev = d;
+		float g = powf(10.0f, -3.0f * (float)d / samples);
+		float ghf = powf(10.0f, -3.0f * (float)d / (samples * high));
+		float ratio = ghf / g;
+		base[i] = d;
+		gain[i] = g;
+		damp[i] = (1.0f - ratio) / (1.0f + ratio);
+	}
+	__disable_irq();
+	for (uint32_t i=0; i < lines; i++) {
+		line[i].base = base[i];
+		line[i].gain = gain[i];
+		line[i].damp = damp[i];
+	}
+	__enable_irq();
+}
+
+void AudioEffectReverbFDN::update(void)
+{
+	audio_block_t *block;
+	float in[AUDIO_BLOCK_SAMPLES];
+	uint32_t i, k;
+
+	block = receiveReadOnly(0);
+	const uint32_t lines = num_lines;
+	if (lines == 0) {
+		if (block) release(block);
+		return;
+	}
+	if (block) {
+		for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+			// 6 dB lower, as long tails build up well above the input
+			in[k] = (float)block->data[k] * (1.0f / 65536.0f);
+		}
+		release(block);
+	} else {
+		memset(in, 0, sizeof(in));
+	}
+
+	// input diffusion
+	float *ap = diffuser;
+	for (i=0; i < 4; i++) {
+		const uint32_t len = diffuser_length[i];
+		const float g = diffuser_gain[i];
+		uint32_t index = diffuser_index[i];
+		for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+			float delayed = ap[index];
+			float w = in[k] + delayed * g;
+			in[k] = delayed - w * g;
+			ap[index] = w;
+			if (++index >= len) index = 0;
+		}
+		diffuser_index[i] = index;
+		ap += len;
+	}
+
+	// read every line for the whole block, through its gain and lowpass
+	const bool hadamard = (matrix_type == REVERB_FDN_HADAMARD);
+	const float scale = (hadamard ? ((lines == 16) ? 0.25f : 0.35355339f) : 1.0f)
+		* (1.0f / STORAGE_SCALE);
+	lfo_phase += lfo_increment;
+	for (i=0; i < lines; i++) {
+		line_t *l = &line[i];
+		const int16_t *buf = l->buffer;
+		const uint32_t len = l->length;
+		uint32_t ph = lfo_phase + i * (0xFFFFFFFFu / lines);
+		uint32_t index = ph >> 24;
+		int32_t val1 = AudioWaveformSine[index];
+		int32_t val2 = AudioWaveformSine[index + 1];
+		float lfo = (float)val1 + (float)(val2 - val1) * (float)(ph & 0xFFFFFF) * (1.0f / 16777216.0f);
+		float end = l->base + mod_depth * lfo * (1.0f / 32767.0f);
+		float delay = ramp_reset ? end : l->delay;
+		const float increment = (end - delay) * (1.0f / AUDIO_BLOCK_SAMPLES);
+		l->delay = end;
+		const float gain = l->gain * scale;
+		const float damp = l->damp;
+		float filter = l->filter;
+		uint32_t head = l->index;
+		float *out = work[i];
+		for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+			uint32_t di = delay;
+			float frac = delay - (float)di;
+			uint32_t j = head + len - di;
+			if (j >= len) j -= len;
+			uint32_t j1 = (j == 0) ? len - 1 : j - 1;
+			float a = buf[j];
+			float x = a + ((float)buf[j1] - a) * frac;
+			filter = x + (filter - x) * damp;
+			out[k] = filter * gain;
+			delay += increment;
+			if (++head >= len) head = 0;
+		}
+		l->filter = filter;
+	}
+	ramp_reset = false;
+
+	// both outputs are taken from the lines before mixing
+	audio_block_t *left = allocate();
+	audio_block_t *right = allocate();
+	if (left && right) {
+		const float outscale = hadamard ? 32768.0f : ((lines == 16) ? 8192.0f : 11585.2f);
+		for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+			float l = 0.0f, r = 0.0f;
+			for (i=0; i < lines; i++) {
+				l += work[i][k] * hadamardSign(1, i);
+				r += work[i][k] * hadamardSign(2, i);
+			}
+			left->data[k] = saturate16((int32_t)(l * outscale));
+			right->data[k] = saturate16((int32_t)(r * outscale));
+		}
+	}
+
+	// mix the lines: fast Walsh-Hadamard transform, or Householder reflection
+	if (hadamard) {
+		for (uint32_t h=1; h < lines; h <<= 1) {
+			for (i=0; i < lines; i += h * 2) {
+				for (uint32_t j=i; j < i + h; j++) {
+					float *p1 = work[j];
+					float *p2 = work[j + h];
+					for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+						float a = p1[k];
+						float b = p2[k];
+						p1[k] = a + b;
+						p2[k] = a - b;
+					}
+				}
+			}
+		}
+	} else {
+		const float twoN = 2.0f / (float)lines;
+		for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+			float sum = 0.0f;
+			for (i=0; i < lines; i++) sum += work[i][k];
+			sum *= twoN;
+			for (i=0; i < lines; i++) work[i][k] -= sum;
+		}
+	}
+
+	// add the input, and write the block into every line
+	for (i=0; i < lines; i++) {
+		line_t *l = &line[i];
+		int16_t *buf = l->buffer;
+		const uint32_t len = l->length;
+		const float *p = work[i];
+		const float sign = hadamardSign(3, i);
+		uint32_t head = l->index;
+		for (k=0; k < AUDIO_BLOCK_SAMPLES; k++) {
+			// Round, except truncate toward zero near silence.  Rounding
+			// alone lets the last few bits circulate for ever.
+			float v = (p[k] + in[k] * sign) * STORAGE_SCALE;
+			buf[head] = (fabsf(v) < 2.0f) ? (int32_t)v : saturate16(lrintf(v));
+			if (++head >= len) head = 0;
+		}
+		l->index = head;
+	}
+
+	if (left) {
+		if (right) transmit(left, 0);
+		release(left);
+	}
+	if (right) {
+		if (left) transmit(right, 1);
+		release(right);
+	}
+}
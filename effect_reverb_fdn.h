@@ -0,0 +1,117 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+
+#ifndef effect_reverb_fdn_h_
+#define effect_reverb_fdn_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Feedback delay network reverb.  8 or 16 delay lines, of prime lengths
+// spread over roughly 3:1, are fed back into each other through a lossless
+// mixing matrix.  Each line has a gain and a one pole lowpass, set from its
+// length, so every line decays at the same rate at low and high frequencies.
+//
+// The input first passes through 4 allpass filters, so the echoes are dense
+// from the start.  Every line is at least one block long, so all lines are read for a whole
+// block, mixed, and then written, one line at a time.  The delay memory is
+// 16 bit samples supplied by begin(), which may be in DMAMEM or EXTMEM.  The
+// lines may be slowly modulated, to soften metallic ringing.  Intended for
+// Teensy 4.x.
+
+#define REVERB_FDN_MAX_LINES 16
+
+#define REVERB_FDN_HADAMARD    0
+#define REVERB_FDN_HOUSEHOLDER 1
+
+class AudioEffectReverbFDN : public AudioStream
+{
+public:
+	AudioEffectReverbFDN(void);
+	// delay memory, in any RAM including EXTMEM, and 8 or 16 lines
+	bool begin(int16_t *memory, uint32_t length, int lines = 8);
+	virtual void update(void);
+
+	// 0 to 1, the longest line from 20 to 100 ms, if the memory allows
+	void roomsize(float n) {
+		if (n > 1.0f) n = 1.0f;
+		else if (n < 0.0f) n = 0.0f;
+		room_size = n;
+		updateLines();
+	}
+	// time for the tail to fall by 60 dB, at low frequencies
+	void reverbTime(float seconds) {
+		if (seconds < 0.1f) seconds = 0.1f;
+		else if (seconds > 100.0f) seconds = 100.0f;
+		reverb_time = seconds;
+		updateLines();
+	}
+	// 0 to 1, how much faster the high frequencies decay, up to 10 times
+	void damping(float n) {
+		if (n > 1.0f) n = 1.0f;
+		else if (n < 0.0f) n = 0.0f;
+		damping_amount = n;
+		updateLines();
+	}
+	// vary each line's length by up to 1 ms, at a slow rate
+	void modulation(float milliseconds, float hz = 0.8f);
+	// REVERB_FDN_HADAMARD (the default) or REVERB_FDN_HOUSEHOLDER
+	void matrix(int type) {
+		__disable_irq();
+		matrix_type = (type == REVERB_FDN_HOUSEHOLDER) ? REVERB_FDN_HOUSEHOLDER : REVERB_FDN_HADAMARD;
+		__enable_irq();
+	}
+private:
+	struct line_t {
+		int16_t *buffer;
+		uint32_t length;       // memory for this line
+		uint32_t index;        // next sample to write
+		float delay;           // at the end of the last block, in samples
+		float base;            // length of the line, without modulation
+		float gain;            // decay per pass, including the matrix scaling
+		float damp;            // lowpass pole
+		float filter;          // lowpass state
+	};
+	void updateLines(void);
+	audio_block_t *inputQueueArray[1];
+	float diffuser[1341];           // 4 allpass filters, input diffusion
+	uint16_t diffuser_index[4];
+	line_t line[REVERB_FDN_MAX_LINES];
+	float work[REVERB_FDN_MAX_LINES][AUDIO_BLOCK_SAMPLES];
+	uint32_t num_lines;
+	uint32_t lfo_phase;
+	uint32_t lfo_increment;        // per block
+	float mod_depth;               // samples
+	float room_size;
+	float reverb_time;
+	float damping_amount;
+	uint8_t matrix_type;
+	bool ramp_reset;               // jump to the new lengths
+};
+
+#endif
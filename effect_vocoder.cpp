@@ -0,0 +1,193 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "effect_vocoder.h"
+#include "biquad.h"
+
+AudioEffectVocoder::AudioEffectVocoder(void) : AudioStream(3, inputQueueArray)
+{
+	memset(analysis, 0, sizeof(analysis));
+	memset(synthesis, 0, sizeof(synthesis));
+	for (int i=0; i < VOCODER_MAX_BANDS; i++) {
+		envelope[i] = 0.0f;
+		band_gain[i] = 1.0f;
+	}
+	output_gain = 1.0f;
+	q_setting = 0.0f;
+	num_bands = 0;
+	attack(5.0f);
+	release(30.0f);
+	frequencies(16);
+}
+
+float AudioEffectVocoder::envelopeCoefficient(float milliseconds)
+{
+	// the envelope is updated once per block
+	const float block_ms = AUDIO_BLOCK_SAMPLES * 1000.0f / AUDIO_SAMPLE_RATE_EXACT;
+	if (milliseconds <= block_ms) return 1.0f;
+	return 1.0f - expf(-block_ms / milliseconds);
+}
+
+void AudioEffectVocoder::frequencies(uint8_t bands, float lowFreq, float highFreq)
+{
+	if (bands < 1) bands = 1;
+	else if (bands > VOCODER_MAX_BANDS) bands = VOCODER_MAX_BANDS;
+	if (lowFreq < 20.0f) lowFreq = 20.0f;
+	if (highFreq > AUDIO_SAMPLE_RATE_EXACT * 0.45f) highFreq = AUDIO_SAMPLE_RATE_EXACT * 0.45f;
+	if (highFreq < lowFreq) highFreq = lowFreq;
+	low_frequency = lowFreq;
+	high_frequency = highFreq;
+	num_bands = bands;
+	design();
+}
+
+void AudioEffectVocoder::q(float n)
+{
+	q_setting = (n > 0.0f) ? n : 0.0f;
+	design();
+}
+
+void AudioEffectVocoder::design(void)
+{
+	float c[VOCODER_MAX_BANDS][5];
+	uint32_t bands = num_bands;
+	float ratio = 2.0f;
+
+	if (bands > 1) ratio = powf(high_frequency / low_frequency, 1.0f / (float)(bands - 1));
+	float q = q_setting;
+	if (q == 0.0f) {
+		// a single section would have its -3 dB points half way to the
+		// neighbouring bands; two cascaded sections need a lower Q for
+		// the bands to meet at a similar level
+		q = 0.65f * sqrtf(ratio) / (ratio - 1.0f);
+	}
+	float freq = low_frequency;
+	for (uint32_t i=0; i < bands; i++) {
+		getCoefficients(c[i], BiquadType::BAND_PASS, 0.0, freq, AUDIO_SAMPLE_RATE_EXACT, q);
+		freq *= ratio;
+	}
+	__disable_irq();
+	memcpy(coef, c, sizeof(c[0]) * bands);
+	__enable_irq();
+}
+
+// transposed direct form II, coefficients are b0, b1, b2, -a1, -a2
+static inline float biquad(const float *c, float *z, float x) __attribute__((always_inline, unused));
+static inline float biquad(const float *c, float *z, float x)
+{
+	float y = c[0] * x + z[0];
+	z[0] = c[1] * x + c[3] * y + z[1];
+	z[1] = c[2] * x + c[4] * y;
+	return y;
+}
+
+void AudioEffectVocoder::update(void)
+{
+	audio_block_t *modulator, *carrier[2], *out;
+	float in[AUDIO_BLOCK_SAMPLES];
+	float car[2][AUDIO_BLOCK_SAMPLES];
+	float sum[2][AUDIO_BLOCK_SAMPLES];
+	uint32_t b, ch, i;
+
+	modulator = receiveReadOnly(0);
+	carrier[0] = receiveReadOnly(1);
+	carrier[1] = receiveReadOnly(2);
+	if (!carrier[0] && !carrier[1]) {
+		if (modulator) AudioStream::release(modulator);
+		return;
+	}
+	if (modulator) {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) in[i] = modulator->data[i];
+		AudioStream::release(modulator);
+	}
+	for (ch=0; ch < 2; ch++) {
+		if (!carrier[ch]) continue;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			car[ch][i] = carrier[ch]->data[i];
+			sum[ch][i] = 0.0f;
+		}
+		AudioStream::release(carrier[ch]);
+	}
+
+	const uint32_t bands = num_bands;
+	const float att = attack_coef, rel = release_coef;
+	// envelope is mean absolute level, normalised to full scale = 1.0
+	const float level_scale = 1.0f / (AUDIO_BLOCK_SAMPLES * 32768.0f);
+	const float ramp_scale = 1.0f / AUDIO_BLOCK_SAMPLES;
+	// each band carries roughly 1/bands of the signal, so scale by the
+	// number of bands to keep the output level independent of the count
+	const float out_scale = output_gain * bands;
+	for (b=0; b < bands; b++) {
+		const float *c = coef[b];
+		// analysis: band level of the modulator for this block
+		float level = 0.0f;
+		if (modulator) {
+			float *z0 = analysis[b].z[0], *z1 = analysis[b].z[1];
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				float y = biquad(c, z0, in[i]);
+				y = biquad(c, z1, y);
+				level += fabsf(y);
+			}
+			level *= level_scale;
+		}
+		float prev = envelope[b];
+		float env = prev + ((level > prev) ? att : rel) * (level - prev);
+		envelope[b] = env;
+		// synthesis: filter the carrier, apply the envelope as a gain
+		// ramp across the block, and accumulate into the output
+		float g = band_gain[b] * out_scale;
+		float gain = prev * g;
+		float step = (env - prev) * g * ramp_scale;
+		for (ch=0; ch < 2; ch++) {
+			if (!carrier[ch]) continue;
+			float *z0 = synthesis[ch][b].z[0], *z1 = synthesis[ch][b].z[1];
+			float *dst = sum[ch], *src = car[ch];
+			float gn = gain;
+			for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+				float y = biquad(c, z0, src[i]);
+				y = biquad(c, z1, y);
+				gn += step;
+				dst[i] += y * gn;
+			}
+		}
+	}
+
+	for (ch=0; ch < 2; ch++) {
+		if (!carrier[ch]) continue;
+		out = allocate();
+		if (!out) continue;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			float y = sum[ch][i];
+			if (y > 32767.0f) y = 32767.0f;
+			else if (y < -32768.0f) y = -32768.0f;
+			out->data[i] = (int16_t)y;
+		}
+		transmit(out, ch);
+		AudioStream::release(out);
+	}
+}
@@ -0,0 +1,92 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef effect_vocoder_h_
+#define effect_vocoder_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Channel vocoder.  The modulator (usually a voice) is split into bands by a
+// bank of 4th order bandpass filters, and the level of each band is followed
+// once per audio block.  The carrier (usually a synth) is split by the same
+// filterbank, and each band is scaled by the matching modulator level, with
+// the gain ramped smoothly across the block, and summed to the output.
+//
+// The analysis is shared by both carrier channels, so stereo vocoding costs
+// only one extra set of synthesis filters.
+
+#define VOCODER_MAX_BANDS 32
+
+class AudioEffectVocoder : public AudioStream
+{
+public:
+	AudioEffectVocoder(void);
+	virtual void update(void);
+
+	// number of bands and their spread, spaced evenly on a log scale
+	void frequencies(uint8_t bands, float lowFreq = 100.0f, float highFreq = 8000.0f);
+	// Q of each filter section, 0 to choose automatically from the spacing
+	void q(float n);
+	// envelope follower times, in milliseconds
+	void attack(float milliseconds) {
+		attack_coef = envelopeCoefficient(milliseconds);
+	}
+	void release(float milliseconds) {
+		release_coef = envelopeCoefficient(milliseconds);
+	}
+	// level of a single band, eg. to emphasise or remove a formant
+	void bandGain(uint8_t band, float gain) {
+		if (band >= VOCODER_MAX_BANDS) return;
+		band_gain[band] = gain;
+	}
+	// overall output level
+	void gain(float n) {
+		output_gain = n;
+	}
+private:
+	static float envelopeCoefficient(float milliseconds);
+	void design(void);
+	struct section_t {
+		float z[2][2];   // two cascaded biquad sections
+	};
+	float coef[VOCODER_MAX_BANDS][5]; // b0, b1, b2, -a1, -a2
+	section_t analysis[VOCODER_MAX_BANDS];
+	section_t synthesis[2][VOCODER_MAX_BANDS];
+	float envelope[VOCODER_MAX_BANDS];
+	float band_gain[VOCODER_MAX_BANDS];
+	float low_frequency;
+	float high_frequency;
+	float q_setting;
+	volatile float attack_coef;
+	volatile float release_coef;
+	volatile float output_gain;
+	volatile uint8_t num_bands;
+	audio_block_t *inputQueueArray[3];
+};
+
+#endif
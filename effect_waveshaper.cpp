@@ -24,11 +24,82 @@
 
 #include <Arduino.h>
 #include "effect_waveshaper.h"
+#include "utility/dspinst.h"
+
+// Half-band lowpass filters for the oversampling, Kaiser windowed,
+// about 70 dB stopband attenuation.  Only the odd taps are listed (the
+// even taps are zero, except the centre tap which is 0.5), in Q15.
+// The first stage passes up to about 18.5 kHz, the second stage (4x
+// only) works on audio which is already band limited, so it can be short.
+#define HALFBAND1_TAPS 16
+static const int16_t halfband1[HALFBAND1_TAPS] = {
+  10395, -3373, 1917, -1261, 877, -623, 443, -311,
+  214, -143, 92, -56, 32, -16, 7, -2
+};
+#define HALFBAND2_TAPS 6
+static const int16_t halfband2[HALFBAND2_TAPS] = {
+  10154, -2721, 1031, -345, 79, -6
+};
+
+// Double the sample rate of n samples.  The history holds the last
+// 2*taps-1 input samples from the previous call.
+static void upsample(int16_t *history, const int16_t *coef, int taps,
+  const int16_t *in, int n, int16_t *out, int16_t *scratch)
+{
+  const int hlen = 2 * taps - 1;
+  memcpy(scratch, history, hlen * sizeof(int16_t));
+  memcpy(scratch + hlen, in, n * sizeof(int16_t));
+  for (int m = 0; m < n; m++) {
+    const int16_t *x = scratch + m + hlen - taps;
+    int32_t sum = 0;
+    for (int j = 0; j < taps; j++) {
+      sum += coef[j] * (x[-j] + x[1 + j]);
+    }
+    *out++ = x[0];
+    // gain of 2 makes up for the inserted zeros
+    *out++ = saturate16((sum + 8192) >> 14);
+  }
+  memcpy(history, scratch + n, hlen * sizeof(int16_t));
+}
+
+// Halve the sample rate of 2*n samples.  The history holds the last
+// 4*taps-3 input samples from the previous call.
+static void downsample(int16_t *history, const int16_t *coef, int taps,
+  const int16_t *in, int n, int16_t *out, int16_t *scratch)
+{
+  const int hlen = 4 * taps - 3;
+  memcpy(scratch, history, hlen * sizeof(int16_t));
+  memcpy(scratch + hlen, in, 2 * n * sizeof(int16_t));
+  for (int m = 0; m < n; m++) {
+    const int16_t *u = scratch + 2 * m + 2 * taps - 1;
+    int32_t sum = u[0] << 14;
+    for (int j = 0; j < taps; j++) {
+      sum += coef[j] * (u[-2 * j - 1] + u[2 * j + 1]);
+    }
+    *out++ = saturate16((sum + 16384) >> 15);
+  }
+  memcpy(history, scratch + 2 * n, hlen * sizeof(int16_t));
+}
+
+static void applyShape(const int16_t *waveshape, int16_t lerpshift, int16_t *data, int n)
+{
+  uint16_t x, xa;
+  int16_t ya, yb;
+  for (int i = 0; i < n; i++) {
+    // bring int16_t data into uint16_t range
+    x = data[i] + 32768;
+    // lerp waveshape (from http://coranac.com/tonc/text/fixed.htm)
+    xa = x >> lerpshift;
+    ya = waveshape[xa];
+    yb = waveshape[xa + 1];
+    data[i] = ya + ((yb - ya) * (x - (xa << lerpshift)) >> lerpshift);
+  }
+}
 
 AudioEffectWaveshaper::~AudioEffectWaveshaper()
 {
-  if(this->waveshape) {
-    delete [] this->waveshape;
+  if(this->allocated) {
+    delete [] this->allocated;
   }
 }
 
@@ -38,14 +109,38 @@ void AudioEffectWaveshaper::shape(float* waveshape, int length)
   // anything else means we don't continue
   if(!waveshape || length < 2 || length > 32769 || ((length - 1) & (length - 2))) return;
 
-  if(this->waveshape) {
-    delete [] this->waveshape;
-  }
-  this->waveshape = new int16_t[length];
+  int16_t* table = new int16_t[length];
   for(int i = 0; i < length; i++) {
-    this->waveshape[i] = 32767 * waveshape[i];
+    table[i] = 32767 * waveshape[i];
+  }
+  int16_t* old = this->allocated;
+  __disable_irq();
+  this->waveshape = table;
+  this->allocated = table;
+  setLerpshift(length);
+  __enable_irq();
+  if(old) {
+    delete [] old;
+  }
+}
+
+void AudioEffectWaveshaper::shape(const int16_t* waveshape, int length)
+{
+  if(!waveshape || length < 2 || length > 32769 || ((length - 1) & (length - 2))) return;
+
+  int16_t* old = this->allocated;
+  __disable_irq();
+  this->waveshape = waveshape;
+  this->allocated = nullptr;
+  setLerpshift(length);
+  __enable_irq();
+  if(old) {
+    delete [] old;
   }
+}
 
+void AudioEffectWaveshaper::setLerpshift(int length)
+{
   // set lerpshift to the number of bits to shift while interpolating
   // to cover the entire waveshape over a uint16_t input range
   int index = length - 1;
@@ -53,6 +148,18 @@ void AudioEffectWaveshaper::shape(float* waveshape, int length)
   while (index >>= 1) --lerpshift;
 }
 
+void AudioEffectWaveshaper::oversample(int n)
+{
+  if (n != 1 && n != 2 && n != 4) return;
+  __disable_irq();
+  factor = n;
+  memset(up1_history, 0, sizeof(up1_history));
+  memset(down1_history, 0, sizeof(down1_history));
+  memset(up2_history, 0, sizeof(up2_history));
+  memset(down2_history, 0, sizeof(down2_history));
+  __enable_irq();
+}
+
 void AudioEffectWaveshaper::update(void)
 {
   if(!waveshape) return;
@@ -61,16 +168,25 @@ void AudioEffectWaveshaper::update(void)
   block = receiveWritable();
   if (!block) return;
 
-  uint16_t x, xa;
-  int16_t i, ya, yb;
-  for (i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
-    // bring int16_t data into uint16_t range
-    x = block->data[i] + 32768;
-    // lerp waveshape (from http://coranac.com/tonc/text/fixed.htm)
-    xa = x >> lerpshift;
-    ya = waveshape[xa];
-    yb = waveshape[xa + 1];
-    block->data[i] = ya + ((yb - ya) * (x - (xa << lerpshift)) >> lerpshift);
+  if (factor == 1) {
+    applyShape(waveshape, lerpshift, block->data, AUDIO_BLOCK_SAMPLES);
+  } else {
+    int16_t buf2[AUDIO_BLOCK_SAMPLES * 2];
+    int16_t scratch[AUDIO_BLOCK_SAMPLES * 4 + 4 * HALFBAND2_TAPS];
+    upsample(up1_history, halfband1, HALFBAND1_TAPS, block->data,
+      AUDIO_BLOCK_SAMPLES, buf2, scratch);
+    if (factor == 2) {
+      applyShape(waveshape, lerpshift, buf2, AUDIO_BLOCK_SAMPLES * 2);
+    } else {
+      int16_t buf4[AUDIO_BLOCK_SAMPLES * 4];
+      upsample(up2_history, halfband2, HALFBAND2_TAPS, buf2,
+        AUDIO_BLOCK_SAMPLES * 2, buf4, scratch);
+      applyShape(waveshape, lerpshift, buf4, AUDIO_BLOCK_SAMPLES * 4);
+      downsample(down2_history, halfband2, HALFBAND2_TAPS, buf4,
+        AUDIO_BLOCK_SAMPLES * 2, buf2, scratch);
+    }
+    downsample(down1_history, halfband1, HALFBAND1_TAPS, buf2,
+      AUDIO_BLOCK_SAMPLES, block->data, scratch);
   }
 
   transmit(block);
@@ -28,17 +28,112 @@
 #include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
 #include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
 
+enum AudioWaveshapeCurve {
+  WAVESHAPE_TANH,
+  WAVESHAPE_SOFT_CLIP,
+  WAVESHAPE_HARD_CLIP,
+  WAVESHAPE_FOLDBACK
+};
+
+// A shaping table computed entirely by the compiler, so it needs no RAM
+// and no startup time when placed in flash, eg.
+//
+//   PROGMEM constexpr AudioWaveshapeTable<257> fuzz(WAVESHAPE_TANH, 4.0f);
+//   waveshape1.shape(fuzz);
+//
+// drive scales the input before the curve is applied.  All curves are
+// normalised so that input +/-1.0 maps to output +/-1.0, except foldback.
+template <int length>
+struct AudioWaveshapeTable
+{
+  static_assert(length >= 2 && length <= 32769 && ((length - 1) & (length - 2)) == 0,
+    "AudioWaveshapeTable length must be a power of two + 1");
+  int16_t data[length];
+
+  constexpr AudioWaveshapeTable(AudioWaveshapeCurve curve, float drive = 1.0f) : data() {
+    for (int i = 0; i < length; i++) {
+      float x = (float)(2 * i - (length - 1)) / (float)(length - 1);
+      float y = evaluate(curve, x, drive) * 32767.0f;
+      data[i] = (int16_t)(y < 0.0f ? y - 0.5f : y + 0.5f);
+    }
+  }
+
+  static constexpr float clip(float x) {
+    return x > 1.0f ? 1.0f : (x < -1.0f ? -1.0f : x);
+  }
+  static constexpr float exponential(float x) {
+    // halve the argument until the series converges quickly, then square
+    int halvings = 0;
+    while (x > 0.5f || x < -0.5f) {
+      x *= 0.5f;
+      halvings++;
+    }
+    float sum = 1.0f, term = 1.0f;
+    for (int n = 1; n < 10; n++) {
+      term *= x / (float)n;
+      sum += term;
+    }
+    while (halvings-- > 0) sum *= sum;
+    return sum;
+  }
+  static constexpr float hyperbolicTangent(float x) {
+    if (x > 10.0f) return 1.0f;
+    if (x < -10.0f) return -1.0f;
+    float e = exponential(2.0f * x);
+    return (e - 1.0f) / (e + 1.0f);
+  }
+  static constexpr float evaluate(AudioWaveshapeCurve curve, float x, float drive) {
+    float d = drive > 0.0f ? drive : 1.0f;
+    float xd = x * d;
+    switch (curve) {
+      case WAVESHAPE_TANH:
+        return hyperbolicTangent(xd) / hyperbolicTangent(d);
+      case WAVESHAPE_SOFT_CLIP:
+        // cubic soft clipper, 1.5x - 0.5x^3
+        xd = clip(xd);
+        return 1.5f * xd - 0.5f * xd * xd * xd;
+      case WAVESHAPE_HARD_CLIP:
+        return clip(xd);
+      case WAVESHAPE_FOLDBACK: {
+        // triangle fold with period 4, so levels beyond +/-1.0 reflect back
+        float t = xd + 1.0f;
+        t -= 4.0f * (float)(int)(t * 0.25f);
+        if (t < 0.0f) t += 4.0f;
+        return 1.0f - (t > 2.0f ? t - 2.0f : 2.0f - t);
+      }
+    }
+    return x;
+  }
+};
+
 class AudioEffectWaveshaper : public AudioStream
 {
   public:
-    AudioEffectWaveshaper(void): AudioStream(1, inputQueueArray), waveshape(nullptr) {}
+    AudioEffectWaveshaper(void): AudioStream(1, inputQueueArray), waveshape(nullptr),
+      allocated(nullptr), factor(1) { oversample(1); }
     ~AudioEffectWaveshaper();
     virtual void update(void);
     void shape(float* waveshape, int length);
+    // use a table of int16_t directly, without copying it to RAM
+    void shape(const int16_t* waveshape, int length);
+    template <int length>
+    void shape(const AudioWaveshapeTable<length>& table) {
+      shape(table.data, length);
+    }
+    // run the shaper at 2x or 4x the sample rate, to reduce aliasing
+    void oversample(int n);
   private:
+    void setLerpshift(int length);
     audio_block_t *inputQueueArray[1];
-    int16_t* waveshape;
+    const int16_t* waveshape;
+    int16_t* allocated;
     int16_t lerpshift;
+    uint8_t factor;
+    // half-band filter history, see effect_waveshaper.cpp
+    int16_t up1_history[31];
+    int16_t down1_history[61];
+    int16_t up2_history[11];
+    int16_t down2_history[21];
 };
 
 #endif
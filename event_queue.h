@@ -0,0 +1,120 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef event_queue_h_
+#define event_queue_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Sample accurate parameter changes.  loop() posts events, each with a time
+// in samples, a parameter and a value, to a queue given to an audio object.
+// The object's update() splits its block at each event's position, so the
+// change happens on the exact sample, rather than at the next block.
+//
+// One queue per object.  It is lock free, with loop() (or any one interrupt)
+// writing and update() reading, so no interrupts are disabled.  Events must
+// be posted in time order.  Events for times already past take effect at
+// the start of the next block.
+
+#define AUDIO_EVENT_QUEUE_SIZE 16  // must be a power of 2
+
+#define AUDIO_EVENT_FREQUENCY   1  // AudioSynthWaveform
+#define AUDIO_EVENT_AMPLITUDE   2  // AudioSynthWaveform
+#define AUDIO_EVENT_OFFSET      3  // AudioSynthWaveform
+#define AUDIO_EVENT_PHASE       4  // AudioSynthWaveform
+#define AUDIO_EVENT_PULSE_WIDTH 5  // AudioSynthWaveform
+#define AUDIO_EVENT_GAIN        6  // AudioMixer4, index is the channel
+#define AUDIO_EVENT_NOTE_ON     7  // AudioEffectEnvelope, AudioSynthDrumMachine
+#define AUDIO_EVENT_NOTE_OFF    8  // AudioEffectEnvelope
+
+typedef struct audio_event_struct {
+	uint32_t time;   // in samples, see AudioEventQueue::now()
+	uint8_t  param;
+	uint8_t  index;
+	float    value;
+} audio_event_t;
+
+class AudioEventQueue
+{
+public:
+	AudioEventQueue(void) : head(0), tail(0) {
+		block_time = current_time = clock;
+	}
+	// The time, in samples, of the first sample of the next block.
+	static uint32_t now(void) { return clock; }
+	// Returns false if the queue is full.
+	bool post(uint32_t time, uint8_t param, float value, uint8_t index = 0) {
+		uint32_t h = head;
+		uint32_t next = (h + 1) & (AUDIO_EVENT_QUEUE_SIZE - 1);
+		if (next == tail) return false;
+		queue[h].time = time;
+		queue[h].param = param;
+		queue[h].index = index;
+		queue[h].value = value;
+		// the event must be complete before update() can see it
+		asm volatile("" ::: "memory");
+		head = next;
+		return true;
+	}
+	bool isEmpty(void) { return head == tail; }
+
+	// For update(): call beginBlock() once, first.  Then nextOffset() is the
+	// position in this block of the next event, or AUDIO_BLOCK_SAMPLES when
+	// none is due, and pop() removes each event due at or before offset.
+	void beginBlock(void) {
+		current_time = block_time;
+		block_time += AUDIO_BLOCK_SAMPLES;
+		if ((int32_t)(block_time - clock) > 0) clock = block_time;
+	}
+	int nextOffset(void) {
+		uint32_t t = tail;
+		if (t == head) return AUDIO_BLOCK_SAMPLES;
+		int32_t offset = queue[t].time - current_time;
+		if (offset < 0) return 0;
+		if (offset > AUDIO_BLOCK_SAMPLES) return AUDIO_BLOCK_SAMPLES;
+		return offset;
+	}
+	bool pop(int offset, audio_event_t &event) {
+		uint32_t t = tail;
+		if (t == head) return false;
+		if ((int32_t)(queue[t].time - current_time) > offset) return false;
+		event = queue[t];
+		asm volatile("" ::: "memory");
+		tail = (t + 1) & (AUDIO_EVENT_QUEUE_SIZE - 1);
+		return true;
+	}
+private:
+	audio_event_t queue[AUDIO_EVENT_QUEUE_SIZE];
+	volatile uint8_t head;    // written only by post()
+	volatile uint8_t tail;    // written only by pop()
+	uint32_t block_time;      // time of the next block's first sample
+	uint32_t current_time;    // time of this block's first sample
+	static volatile uint32_t clock;
+};
+
+#endif
@@ -0,0 +1,86 @@
+// Tape echo, with wow and flutter
+//
+// AudioEffectDelayModulated keeps its delay line in an array
+// given by the sketch, in DMAMEM here, or for delays of many
+// seconds in the PSRAM of a Teensy 4.1.  Each tap's delay can
+// be moved smoothly by a signal on its modulation input.
+//
+// Three echoes of the line input are mixed with the original.
+// A slow sine wave (wow) plus a faster, smaller one (flutter)
+// waver the delays, like an old tape echo machine.
+//
+// Requires Teensy 4.x.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,150
+AudioMixer4              mixer1;         //xy=250,150
+AudioSynthWaveformSine   wow;            //xy=100,260
+AudioSynthWaveformSine   flutter;        //xy=100,320
+AudioMixer4              modMixer;       //xy=250,290
+AudioEffectDelayModulated delay1;        //xy=420,200
+AudioMixer4              mixer2;         //xy=600,180
+AudioOutputI2S           i2s2;           //xy=760,180
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, 0, delay1, 0);
+AudioConnection          patchCord4(wow, 0, modMixer, 0);
+AudioConnection          patchCord5(flutter, 0, modMixer, 1);
+AudioConnection          patchCord6(modMixer, 0, delay1, 1);
+AudioConnection          patchCord7(modMixer, 0, delay1, 2);
+AudioConnection          patchCord8(modMixer, 0, delay1, 3);
+AudioConnection          patchCord9(mixer1, 0, mixer2, 0);
+AudioConnection          patchCord10(delay1, 0, mixer2, 1);
+AudioConnection          patchCord11(delay1, 1, mixer2, 2);
+AudioConnection          patchCord12(delay1, 2, mixer2, 3);
+AudioConnection          patchCord13(mixer2, 0, i2s2, 0);
+AudioConnection          patchCord14(mixer2, 0, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=250,400
+// GUItool: end automatically generated code
+
+// one second of delay memory
+DMAMEM int16_t delaybuffer[44100];
+//EXTMEM int16_t delaybuffer[441000];  // 10 seconds, Teensy 4.1 PSRAM
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(16);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+
+  wow.frequency(0.7);
+  wow.amplitude(1.0);
+  flutter.frequency(9);
+  flutter.amplitude(1.0);
+  modMixer.gain(0, 0.8);
+  modMixer.gain(1, 0.2);
+
+  delay1.begin(delaybuffer, 44100);
+  // the repeats of a tape echo with three playback heads
+  delay1.delay(0, 180);
+  delay1.delay(1, 360);
+  delay1.delay(2, 540);
+  // full scale modulation moves each tap this far, in milliseconds
+  delay1.modulation(0, 0.8);
+  delay1.modulation(1, 1.2);
+  delay1.modulation(2, 1.6);
+
+  mixer2.gain(0, 0.6);   // dry
+  mixer2.gain(1, 0.4);   // echoes, each quieter than the last
+  mixer2.gain(2, 0.25);
+  mixer2.gain(3, 0.15);
+}
+
+void loop() {
+}
@@ -0,0 +1,78 @@
+// Chorus, ensemble and flanger, from one effect
+//
+// AudioEffectEnsemble reads several delayed copies of its input,
+// each swept by its own phase of one LFO, and spreads them across
+// the stereo outputs.  A few voices and a long delay make a
+// chorus, more voices a lush string ensemble, and a short delay
+// with feedback a flanger.  The line input is processed with each
+// setting in turn, for 10 seconds each.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,150
+AudioMixer4              mixer1;         //xy=250,150
+AudioEffectEnsemble      ensemble1;      //xy=400,150
+AudioOutputI2S           i2s2;           //xy=560,150
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, ensemble1);
+AudioConnection          patchCord4(ensemble1, 0, i2s2, 0);
+AudioConnection          patchCord5(ensemble1, 1, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=250,260
+// GUItool: end automatically generated code
+
+// 2048 samples allows delays up to 46 ms
+int16_t delayline[2048];
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(8);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+  ensemble1.begin(delayline, 2048);
+}
+
+void loop() {
+  Serial.println("Chorus");
+  ensemble1.voices(3);
+  ensemble1.delay(20);
+  ensemble1.depth(4);
+  ensemble1.rate(0.8);
+  ensemble1.spread(0.7);
+  ensemble1.feedback(0);
+  ensemble1.mix(0.7, 0.7);
+  delay(10000);
+
+  Serial.println("Ensemble");
+  ensemble1.voices(6);
+  ensemble1.delay(12);
+  ensemble1.depth(5);
+  ensemble1.rate(0.5);
+  ensemble1.spread(1.0);
+  ensemble1.feedback(0);
+  ensemble1.mix(0.5, 0.8);
+  delay(10000);
+
+  Serial.println("Flanger");
+  ensemble1.voices(1);
+  ensemble1.delay(2.5);
+  ensemble1.depth(2);
+  ensemble1.rate(0.2);
+  ensemble1.spread(0);
+  ensemble1.feedback(0.7);
+  ensemble1.mix(0.7, 0.7);
+  delay(10000);
+}
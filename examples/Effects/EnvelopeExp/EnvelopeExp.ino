@@ -0,0 +1,69 @@
+// Analog style envelope, with exponential segments
+//
+// AudioEffectEnvelopeExp shapes its inputs like the envelope
+// generator of an analog synthesizer.  Output 4 is the envelope
+// itself, which here sweeps a filter, for the classic plucked
+// bass of subtractive synthesis.  The same notes are played with
+// the curve() setting from nearly linear to strongly exponential.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthWaveform       waveform1;      //xy=100,150
+AudioEffectEnvelopeExp   envelope1;      //xy=260,150
+AudioFilterStateVariable filter1;        //xy=430,150
+AudioOutputI2S           i2s1;           //xy=590,150
+AudioConnection          patchCord1(waveform1, 0, envelope1, 0);
+AudioConnection          patchCord2(envelope1, 0, filter1, 0);
+AudioConnection          patchCord3(envelope1, 4, filter1, 1);
+AudioConnection          patchCord4(filter1, 0, i2s1, 0);
+AudioConnection          patchCord5(filter1, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=430,260
+// GUItool: end automatically generated code
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  waveform1.begin(0.7, 55, WAVEFORM_SAWTOOTH);
+
+  envelope1.attack(5);
+  envelope1.hold(0);
+  envelope1.decay(400);
+  envelope1.sustain(0.3);
+  envelope1.release(300);
+
+  // the envelope moves the filter up to 4 octaves above 150 Hz
+  filter1.frequency(150);
+  filter1.resonance(2.5);
+  filter1.octaveControl(4);
+}
+
+const float notes[8] = { 55, 55, 110, 55, 65.41, 55, 98, 82.41 };
+
+void loop() {
+  for (int c=0; c <= 4; c++) {
+    float shape = c * 0.25;
+    Serial.print("curve ");
+    Serial.println(shape);
+    envelope1.curve(shape);
+    for (int i=0; i < 8; i++) {
+      waveform1.frequency(notes[i]);
+      envelope1.noteOn();
+      delay(150);
+      envelope1.noteOff();
+      delay(100);
+    }
+    delay(500);
+  }
+}
@@ -0,0 +1,79 @@
+// Freeverb with its memory in DMAMEM or EXTMEM
+//
+// AudioEffectFreeverbStereoExt is the same reverb as
+// AudioEffectFreeverbStereo, but the 50 kbytes of comb and
+// allpass filter memory is an array given by the sketch, so it
+// can go in DMAMEM or in the PSRAM of a Teensy 4.1, leaving the
+// fast RAM for other things.  In half rate mode the reverb runs
+// at 22 kHz, for half the memory and about half the CPU time.
+//
+// The line input is mixed with the reverb.  The CPU usage is
+// printed to the Arduino Serial Monitor.
+//
+// Requires Teensy 4.x.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,180
+AudioMixer4              mixer1;         //xy=250,180
+AudioEffectFreeverbStereoExt freeverbs1; //xy=410,120
+AudioMixer4              mixerLeft;      //xy=580,140
+AudioMixer4              mixerRight;     //xy=580,220
+AudioOutputI2S           i2s2;           //xy=740,180
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, freeverbs1);
+AudioConnection          patchCord4(freeverbs1, 0, mixerLeft, 0);
+AudioConnection          patchCord5(freeverbs1, 1, mixerRight, 0);
+AudioConnection          patchCord6(i2s1, 0, mixerLeft, 1);
+AudioConnection          patchCord7(i2s1, 1, mixerRight, 1);
+AudioConnection          patchCord8(mixerLeft, 0, i2s2, 0);
+AudioConnection          patchCord9(mixerRight, 0, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=250,300
+// GUItool: end automatically generated code
+
+// Change to true for half rate mode
+const bool halfRate = false;
+
+DMAMEM int16_t reverbMemory[FREEVERB_STEREO_MEMORY];
+//EXTMEM int16_t reverbMemory[FREEVERB_STEREO_MEMORY];  // Teensy 4.1 PSRAM
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(12);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+  mixerLeft.gain(0, 0.6);   // reverb
+  mixerLeft.gain(1, 0.5);   // dry
+  mixerRight.gain(0, 0.6);
+  mixerRight.gain(1, 0.5);
+
+  if (!freeverbs1.begin(reverbMemory, FREEVERB_STEREO_MEMORY, halfRate)) {
+    while (1) {
+      Serial.println("Not enough memory for the reverb");
+      delay(500);
+    }
+  }
+  freeverbs1.roomsize(0.8);
+  freeverbs1.damping(0.5);
+}
+
+void loop() {
+  Serial.print("CPU: ");
+  Serial.print(freeverbs1.processorUsage());
+  Serial.print("%, max: ");
+  Serial.print(freeverbs1.processorUsageMax());
+  Serial.println("%");
+  delay(1000);
+}
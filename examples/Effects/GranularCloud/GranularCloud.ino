@@ -0,0 +1,79 @@
+// Granular cloud, turning the line input into a texture
+//
+// AudioEffectGranularCloud records its input continuously, and
+// plays many short overlapping grains of it, each from a random
+// point in the recent past, at its own pitch and stereo position.
+//
+// This example steps through three settings, 10 seconds each: a
+// soft cloud at the original pitch, a shimmer an octave up, and
+// a frozen drone, which keeps playing the last 2 seconds of audio
+// recorded while the input is ignored.
+//
+// Requires Teensy 4.x.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,150
+AudioMixer4              mixer1;         //xy=250,150
+AudioEffectGranularCloud granularCloud1; //xy=420,150
+AudioOutputI2S           i2s2;           //xy=600,150
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, granularCloud1);
+AudioConnection          patchCord4(granularCloud1, 0, i2s2, 0);
+AudioConnection          patchCord5(granularCloud1, 1, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=250,260
+// GUItool: end automatically generated code
+
+// 2 seconds of recording
+DMAMEM int16_t grainMemory[88200];
+//EXTMEM int16_t grainMemory[1323000];  // 30 seconds, Teensy 4.1 PSRAM
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+  granularCloud1.begin(grainMemory, 88200);
+  granularCloud1.window(GRANULAR_WINDOW_HANN);
+  granularCloud1.spread(0.8);
+}
+
+void loop() {
+  Serial.println("Cloud");
+  granularCloud1.freeze(false);
+  granularCloud1.density(30);
+  granularCloud1.grainLength(120);
+  granularCloud1.position(300);
+  granularCloud1.pitch(1.0);
+  granularCloud1.jitter(250, 0.1, 0.5);
+  delay(10000);
+
+  Serial.println("Shimmer");
+  granularCloud1.density(60);
+  granularCloud1.grainLength(80);
+  granularCloud1.position(200);
+  granularCloud1.pitch(2.0);
+  granularCloud1.jitter(150, 0.2, 0.3);
+  delay(10000);
+
+  Serial.println("Frozen");
+  granularCloud1.freeze(true);
+  granularCloud1.density(20);
+  granularCloud1.grainLength(300);
+  granularCloud1.position(1000);
+  granularCloud1.pitch(1.0);
+  granularCloud1.jitter(900, 0, 0.8);
+  delay(10000);
+}
@@ -0,0 +1,90 @@
+// 10 band graphic equalizer, in software
+//
+// AudioFilterEqualizer works with any codec or DAC, not only the
+// SGTL5000 with its built in equalizer.  Here the stereo line
+// input passes through one equalizer per channel, switching
+// between a few preset curves every 5 seconds.  The last preset
+// uses the parametric bands instead: a low cut and a narrow notch.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=150,150
+AudioFilterEqualizer     eqLeft;         //xy=320,120
+AudioFilterEqualizer     eqRight;        //xy=320,180
+AudioOutputI2S           i2s2;           //xy=490,150
+AudioConnection          patchCord1(i2s1, 0, eqLeft, 0);
+AudioConnection          patchCord2(i2s1, 1, eqRight, 0);
+AudioConnection          patchCord3(eqLeft, 0, i2s2, 0);
+AudioConnection          patchCord4(eqRight, 0, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=320,260
+// GUItool: end automatically generated code
+
+// gain in dB for the bands at 31, 62, 125, 250, 500 Hz, 1, 2, 4, 8, 16 kHz
+const float presets[][10] = {
+  {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  // flat
+  {  6,  5,  3,  1,  0,  0,  0,  0,  0,  0 },  // bass boost
+  { -3, -2,  0,  2,  3,  3,  2,  0, -2, -4 },  // voice
+  {  5,  4,  1, -1, -3, -3, -1,  2,  4,  5 },  // loudness, "smile"
+};
+const char *names[] = { "Flat", "Bass boost", "Voice", "Loudness" };
+const int numPresets = 4;
+
+void graphic(int n) {
+  Serial.println(names[n]);
+  for (int band=0; band < 10; band++) {
+    eqLeft.gain(band, presets[n][band]);
+    eqRight.gain(band, presets[n][band]);
+  }
+}
+
+void parametric(AudioFilterEqualizer &eq) {
+  // start again from nothing, then add just the bands needed
+  for (int band=0; band < 10; band++) {
+    eq.disable(band);
+  }
+  eq.band(0, 80, 0, 0.707, FILTER_HIPASS);    // rumble filter
+  eq.band(1, 60, -30, 8.0, FILTER_PARAEQ);    // remove mains hum
+  eq.band(2, 3000, 3, 1.0, FILTER_PARAEQ);    // a little presence
+}
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(8);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  // 10 bands, one per octave, from 31.25 Hz to 16 kHz
+  eqLeft.graphic(10);
+  eqRight.graphic(10);
+}
+
+int preset = 0;
+
+void loop() {
+  if (preset < numPresets) {
+    graphic(preset);
+  } else {
+    Serial.println("Parametric");
+    parametric(eqLeft);
+    parametric(eqRight);
+  }
+  delay(5000);
+
+  preset = preset + 1;
+  if (preset > numPresets) {
+    // back to the graphic equalizer
+    preset = 0;
+    eqLeft.graphic(10);
+    eqRight.graphic(10);
+  }
+}
@@ -0,0 +1,107 @@
+// Three band compressor
+//
+// The line input is split into low, mid and high bands by a
+// Linkwitz-Riley crossover.  Each band has its own compressor,
+// so a loud bass note does not pull down the vocals or cymbals.
+// The bands are mixed back together, and a limiter on the sum
+// stops any peaks from clipping.  The gain reduction of each
+// compressor is printed to the Arduino Serial Monitor.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,200
+AudioMixer4              mixer1;         //xy=240,200
+AudioFilterCrossover     crossover1;     //xy=380,200
+AudioEffectDynamics      compLow;        //xy=540,140
+AudioEffectDynamics      compMid;        //xy=540,200
+AudioEffectDynamics      compHigh;       //xy=540,260
+AudioMixer4              mixer2;         //xy=700,200
+AudioEffectDynamics      limiter;        //xy=850,200
+AudioOutputI2S           i2s2;           //xy=1000,200
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, crossover1);
+AudioConnection          patchCord4(crossover1, 0, compLow, 0);
+AudioConnection          patchCord5(crossover1, 1, compMid, 0);
+AudioConnection          patchCord6(crossover1, 2, compHigh, 0);
+AudioConnection          patchCord7(compLow, 0, mixer2, 0);
+AudioConnection          patchCord8(compMid, 0, mixer2, 1);
+AudioConnection          patchCord9(compHigh, 0, mixer2, 2);
+AudioConnection          patchCord10(mixer2, limiter);
+AudioConnection          patchCord11(limiter, 0, i2s2, 0);
+AudioConnection          patchCord12(limiter, 0, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=240,320
+// GUItool: end automatically generated code
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(16);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  // mono mix of the stereo input
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+
+  // bands below 200 Hz, 200 Hz to 3 kHz, and above 3 kHz
+  crossover1.bands(3);
+  crossover1.frequency(0, 200);
+  crossover1.frequency(1, 3000);
+
+  // slow, heavy compression on the bass
+  compLow.compression(-24, 4.0, 6);
+  compLow.detector(DYNAMICS_DETECT_RMS, 20);
+  compLow.attack(20);
+  compLow.release(250);
+  compLow.makeupGain(6);
+
+  // gentle compression on the mid range
+  compMid.compression(-18, 2.5, 6);
+  compMid.attack(10);
+  compMid.release(150);
+  compMid.makeupGain(4);
+
+  // fast compression on the highs
+  compHigh.compression(-20, 3.0, 6);
+  compHigh.attack(2);
+  compHigh.release(80);
+  compHigh.makeupGain(4);
+
+  // the bands always add back up to the original level
+  mixer2.gain(0, 1.0);
+  mixer2.gain(1, 1.0);
+  mixer2.gain(2, 1.0);
+
+  // look ahead 2 ms, so even the fastest peaks are caught
+  limiter.limit(-1.0);
+  limiter.attack(1);
+  limiter.release(50);
+  limiter.lookahead(2);
+}
+
+elapsedMillis msec;
+
+void loop() {
+  if (msec >= 250) {
+    msec = 0;
+    Serial.print("gain reduction, low: ");
+    Serial.print(compLow.gainReduction(), 1);
+    Serial.print(" dB, mid: ");
+    Serial.print(compMid.gainReduction(), 1);
+    Serial.print(" dB, high: ");
+    Serial.print(compHigh.gainReduction(), 1);
+    Serial.print(" dB, limiter: ");
+    Serial.print(limiter.gainReduction(), 1);
+    Serial.println(" dB");
+  }
+}
@@ -0,0 +1,80 @@
+// Pitch shifting, for harmonies and octave effects
+//
+// AudioEffectPitchShift changes the pitch of its input without
+// changing its speed.  PSOLA mode suits a single voice or
+// instrument, and keeps the voice's character (its formants).
+// The phase vocoder mode shifts everything, including chords.
+//
+// The line input is mixed with the shifted copy.  Every 10
+// seconds the setting changes: a harmony a fifth above with
+// PSOLA, an octave below with the vocoder, and an octave above
+// with the formants moving too, for a "chipmunk" voice.
+//
+// Requires Teensy 4.x.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,150
+AudioMixer4              mixer1;         //xy=250,150
+AudioEffectPitchShift    pitchShift1;    //xy=410,200
+AudioMixer4              mixer2;         //xy=580,160
+AudioOutputI2S           i2s2;           //xy=740,160
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, pitchShift1);
+AudioConnection          patchCord4(mixer1, 0, mixer2, 0);
+AudioConnection          patchCord5(pitchShift1, 0, mixer2, 1);
+AudioConnection          patchCord6(mixer2, 0, i2s2, 0);
+AudioConnection          patchCord7(mixer2, 0, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=250,260
+// GUItool: end automatically generated code
+
+// memory for the vocoder at quality 2, a 1024 point FFT
+DMAMEM float vocoderMemory[PITCHSHIFT_VOCODER_MEMORY(1024)];
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+  mixer2.gain(0, 0.6);   // original
+  mixer2.gain(1, 0.6);   // shifted
+
+  pitchShift1.begin(vocoderMemory, PITCHSHIFT_VOCODER_MEMORY(1024));
+}
+
+void loop() {
+  Serial.println("PSOLA, a fifth above");
+  pitchShift1.mode(PITCHSHIFT_PSOLA);
+  pitchShift1.quality(1);
+  pitchShift1.semitones(7);
+  pitchShift1.formant(1.0);
+  delay(10000);
+
+  Serial.println("Vocoder, an octave below");
+  pitchShift1.mode(PITCHSHIFT_VOCODER);
+  pitchShift1.quality(2);
+  pitchShift1.semitones(-12);
+  pitchShift1.formant(1.0);
+  delay(10000);
+
+  Serial.println("Vocoder, an octave above, with the formants");
+  pitchShift1.semitones(12);
+  pitchShift1.formant(0);
+  delay(10000);
+
+  Serial.print("Latency: ");
+  Serial.print(pitchShift1.latency());
+  Serial.println(" ms");
+}
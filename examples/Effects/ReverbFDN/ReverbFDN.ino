@@ -0,0 +1,79 @@
+// Feedback delay network reverb
+//
+// AudioEffectReverbFDN builds a reverb from 8 or 16 delay lines
+// which feed into each other, with the reverb time set directly
+// in seconds.  The line input is mixed with the reverb, which
+// changes every 15 seconds between a small room, a concert hall
+// and a huge, slowly shimmering space.
+//
+// Requires Teensy 4.x.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioInputI2S            i2s1;           //xy=100,180
+AudioMixer4              mixer1;         //xy=250,180
+AudioEffectReverbFDN     reverb1;        //xy=400,120
+AudioMixer4              mixerLeft;      //xy=570,140
+AudioMixer4              mixerRight;     //xy=570,220
+AudioOutputI2S           i2s2;           //xy=730,180
+AudioConnection          patchCord1(i2s1, 0, mixer1, 0);
+AudioConnection          patchCord2(i2s1, 1, mixer1, 1);
+AudioConnection          patchCord3(mixer1, reverb1);
+AudioConnection          patchCord4(reverb1, 0, mixerLeft, 0);
+AudioConnection          patchCord5(reverb1, 1, mixerRight, 0);
+AudioConnection          patchCord6(i2s1, 0, mixerLeft, 1);
+AudioConnection          patchCord7(i2s1, 1, mixerRight, 1);
+AudioConnection          patchCord8(mixerLeft, 0, i2s2, 0);
+AudioConnection          patchCord9(mixerRight, 0, i2s2, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=250,300
+// GUItool: end automatically generated code
+
+// enough for the largest room with 8 delay lines
+DMAMEM int16_t reverbMemory[21300];
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(12);
+  sgtl5000_1.enable();
+  sgtl5000_1.inputSelect(AUDIO_INPUT_LINEIN);
+  sgtl5000_1.volume(0.5);
+
+  mixer1.gain(0, 0.5);
+  mixer1.gain(1, 0.5);
+  mixerLeft.gain(0, 0.5);   // reverb
+  mixerLeft.gain(1, 0.7);   // dry
+  mixerRight.gain(0, 0.5);
+  mixerRight.gain(1, 0.7);
+
+  reverb1.begin(reverbMemory, 21300, 8);
+}
+
+void loop() {
+  Serial.println("Small room");
+  reverb1.roomsize(0.1);
+  reverb1.reverbTime(0.5);
+  reverb1.damping(0.7);
+  reverb1.modulation(0);
+  delay(15000);
+
+  Serial.println("Concert hall");
+  reverb1.roomsize(0.7);
+  reverb1.reverbTime(2.2);
+  reverb1.damping(0.5);
+  reverb1.modulation(0.2);
+  delay(15000);
+
+  Serial.println("Huge space");
+  reverb1.roomsize(1.0);
+  reverb1.reverbTime(12);
+  reverb1.damping(0.2);
+  reverb1.modulation(0.8, 0.5);
+  delay(15000);
+}
@@ -0,0 +1,81 @@
+// Additive synthesis, with up to 128 sine wave partials
+//
+// AudioSynthAdditive adds together many sine waves, each with
+// its own level.  This example plays three sounds: an organ,
+// with the partials of nine drawbars, a bright sound whose
+// partials fade in one at a time, and a bell, with partials
+// tuned away from the harmonic series.
+//
+// Uses floating point, so Teensy 4.x is recommended.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthAdditive       additive1;      //xy=150,150
+AudioOutputI2S           i2s1;           //xy=330,150
+AudioConnection          patchCord1(additive1, 0, i2s1, 0);
+AudioConnection          patchCord2(additive1, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=240,250
+// GUItool: end automatically generated code
+
+const float drawbars[16] = {
+  1.0, 0.8, 0.6, 0.5, 0, 0.4, 0, 0.3, 0, 0, 0, 0, 0, 0, 0, 0.2
+};
+
+// bell partials, as multiples of the fundamental, and their levels
+const float bellRatios[7] = { 0.5, 1.0, 1.19, 1.56, 2.0, 2.51, 2.66 };
+const float bellLevels[7] = { 0.6, 1.0, 0.5, 0.4, 0.6, 0.3, 0.25 };
+
+void silence() {
+  for (int i=1; i <= ADDITIVE_MAX_PARTIALS; i++) {
+    additive1.partial(i, 0);
+    additive1.partialRatio(i, i);
+  }
+}
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(6);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+  additive1.amplitude(0.3);
+}
+
+void loop() {
+  Serial.println("Organ");
+  silence();
+  additive1.frequency(220);
+  additive1.partials(drawbars, 16);
+  delay(2000);
+
+  Serial.println("Partials 1 to 40, one at a time");
+  silence();
+  additive1.frequency(110);
+  for (int i=1; i <= 40; i++) {
+    additive1.partial(i, 1.0 / i);   // the spectrum of a sawtooth
+    delay(100);
+  }
+  delay(1000);
+
+  Serial.println("Bell");
+  silence();
+  additive1.frequency(440);
+  for (int i=0; i < 7; i++) {
+    additive1.partialRatio(i + 1, bellRatios[i]);
+  }
+  additive1.restart();
+  // each partial dies away, the higher ones faster
+  for (float t=0; t < 3.0; t += 0.02) {
+    for (int i=0; i < 7; i++) {
+      additive1.partial(i + 1, bellLevels[i] * expf(-t * bellRatios[i] * 1.5));
+    }
+    delay(20);
+  }
+  delay(500);
+}
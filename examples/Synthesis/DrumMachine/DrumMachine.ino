@@ -0,0 +1,87 @@
+// Drum machine, playing a 16 step pattern
+//
+// AudioSynthDrumMachine has 16 drum voices in one object.  Its
+// default kit is a kick on voice 0, snare 1, closed hi-hat 2,
+// open hi-hat 3, three toms on 4 to 6 and a rim shot on 7.
+//
+// The hits are posted to an AudioEventQueue with the sample on
+// which each step begins, so the timing is exact no matter when
+// loop() gets to them.  Calling drums.noteOn(voice, velocity)
+// also works, with timing to the nearest audio block (2.9 ms).
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthDrumMachine    drums;          //xy=150,150
+AudioOutputI2S           i2s1;           //xy=330,150
+AudioConnection          patchCord1(drums, 0, i2s1, 0);
+AudioConnection          patchCord2(drums, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=240,250
+// GUItool: end automatically generated code
+
+AudioEventQueue queue;
+
+// one row per voice, one character per 16th note.
+// 'X' is an accent, 'x' a normal hit
+const char *pattern[8] = {
+  "X-----x-X-x-----",  // kick
+  "----X-------X--x",  // snare
+  "x-x-x-x-x-x---x-",  // closed hat
+  "------------X---",  // open hat
+  "----------------",  // low tom
+  "---------------x",  // mid tom
+  "--------------x-",  // high tom
+  "-------x--------",  // rim
+};
+
+const float tempo = 110.0;  // beats per minute
+const float stepSamples = AUDIO_SAMPLE_RATE_EXACT * 60.0 / tempo / 4.0;
+
+uint32_t nextStep;   // time of the next step, in samples
+float stepError = 0;
+int step = 0;
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(6);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  drums.eventQueue(queue);
+  // the closed hat cuts off the open hat, like a real hi-hat
+  drums.choke(2, 1);
+  drums.choke(3, 1);
+  // a longer, deeper kick than the preset
+  drums.frequency(0, 45);
+  drums.tone(0, 1.0, 600);
+
+  nextStep = AudioEventQueue::now() + 1000;
+}
+
+void loop() {
+  // post each step a couple of blocks before it is due
+  if ((int32_t)(nextStep - AudioEventQueue::now()) < 2 * AUDIO_BLOCK_SAMPLES) {
+    for (int voice=0; voice < 8; voice++) {
+      char c = pattern[voice][step];
+      if (c == 'X') {
+        queue.post(nextStep, AUDIO_EVENT_NOTE_ON, 1.0, voice);
+      } else if (c == 'x') {
+        queue.post(nextStep, AUDIO_EVENT_NOTE_ON, 0.6, voice);
+      }
+    }
+    // keep the fraction of a sample, so the tempo doesn't drift
+    stepError += stepSamples;
+    uint32_t n = stepError;
+    stepError -= n;
+    nextStep += n;
+    step = (step + 1) & 15;
+  }
+}
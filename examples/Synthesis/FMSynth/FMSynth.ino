@@ -0,0 +1,112 @@
+// Four operator FM synthesis
+//
+// One AudioSynthFM is a whole four operator voice.  This example
+// plays a short phrase with three classic sounds: an electric
+// piano, a bell and a brass patch, using different algorithms.
+// For chords, use one AudioSynthFM per note and a mixer.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthFM             fm1;            //xy=150,150
+AudioOutputI2S           i2s1;           //xy=330,150
+AudioConnection          patchCord1(fm1, 0, i2s1, 0);
+AudioConnection          patchCord2(fm1, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=240,250
+// GUItool: end automatically generated code
+
+void electricPiano() {
+  // two stacks: 2 modulates 1 for the tine, 4 modulates 3 for the body
+  fm1.algorithm(5);
+  fm1.feedback(0);
+  fm1.operatorRatio(1, 1.0);
+  fm1.operatorRatio(2, 14.0);
+  fm1.operatorRatio(3, 1.0);
+  fm1.operatorRatio(4, 1.0);
+  fm1.operatorLevel(1, 1.0);
+  fm1.operatorLevel(2, 0.15);
+  fm1.operatorLevel(3, 1.0);
+  fm1.operatorLevel(4, 0.25);
+  fm1.operatorEnvelope(1, 1, 1500, 0.0, 300);
+  fm1.operatorEnvelope(2, 1, 200, 0.0, 200);
+  fm1.operatorEnvelope(3, 1, 3000, 0.0, 300);
+  fm1.operatorEnvelope(4, 1, 1200, 0.2, 300);
+}
+
+void bell() {
+  // inharmonic ratios give the metallic partials
+  fm1.algorithm(5);
+  fm1.feedback(0);
+  fm1.operatorRatio(1, 1.0);
+  fm1.operatorRatio(2, 3.5);
+  fm1.operatorRatio(3, 2.0);
+  fm1.operatorRatio(4, 5.19);
+  fm1.operatorLevel(1, 1.0);
+  fm1.operatorLevel(2, 0.3);
+  fm1.operatorLevel(3, 0.6);
+  fm1.operatorLevel(4, 0.2);
+  fm1.operatorEnvelope(1, 1, 4000, 0.0, 2000);
+  fm1.operatorEnvelope(2, 1, 2500, 0.0, 2000);
+  fm1.operatorEnvelope(3, 1, 2000, 0.0, 1500);
+  fm1.operatorEnvelope(4, 1, 1000, 0.0, 1000);
+}
+
+void brass() {
+  // one carrier, three modulators in series, with feedback on 4
+  fm1.algorithm(1);
+  fm1.feedback(0.4);
+  fm1.operatorRatio(1, 1.0);
+  fm1.operatorRatio(2, 1.0);
+  fm1.operatorRatio(3, 1.0);
+  fm1.operatorRatio(4, 1.0);
+  fm1.operatorLevel(1, 1.0);
+  fm1.operatorLevel(2, 0.35);
+  fm1.operatorLevel(3, 0.2);
+  fm1.operatorLevel(4, 0.1);
+  fm1.operatorEnvelope(1, 40, 500, 0.8, 150);
+  fm1.operatorEnvelope(2, 80, 600, 0.6, 150);
+  fm1.operatorEnvelope(3, 60, 800, 0.5, 150);
+  fm1.operatorEnvelope(4, 60, 800, 0.5, 150);
+}
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(6);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+  fm1.amplitude(0.8);
+}
+
+const float phrase[] = { 261.63, 329.63, 392.00, 523.25, 392.00, 329.63 };
+
+void playPhrase(int noteLength) {
+  for (int i=0; i < 6; i++) {
+    fm1.noteOn(phrase[i], 0.8);
+    delay(noteLength);
+    fm1.noteOff();
+    delay(50);
+  }
+  delay(1000);
+}
+
+void loop() {
+  Serial.println("Electric piano");
+  electricPiano();
+  playPhrase(400);
+
+  Serial.println("Bell");
+  bell();
+  playPhrase(600);
+
+  Serial.println("Brass");
+  brass();
+  playPhrase(300);
+}
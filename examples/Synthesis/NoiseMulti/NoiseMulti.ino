@@ -0,0 +1,73 @@
+// Ocean waves and wind, from independent noise sources
+//
+// AudioSynthNoiseMulti makes 8 noise signals at once, each
+// unrelated to the others, for less CPU time than 8 separate
+// noise objects.  Two pink noise outputs, one for each ear, give
+// a wide stereo wash of surf which swells and fades.  Two white
+// noise outputs, through slowly moving band pass filters, make
+// the wind.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthNoiseMulti     noise1;         //xy=120,180
+AudioFilterStateVariable windLeft;       //xy=300,220
+AudioFilterStateVariable windRight;      //xy=300,290
+AudioMixer4              mixerLeft;      //xy=480,160
+AudioMixer4              mixerRight;     //xy=480,250
+AudioOutputI2S           i2s1;           //xy=650,200
+AudioConnection          patchCord1(noise1, 0, mixerLeft, 0);
+AudioConnection          patchCord2(noise1, 1, mixerRight, 0);
+AudioConnection          patchCord3(noise1, 2, windLeft, 0);
+AudioConnection          patchCord4(noise1, 3, windRight, 0);
+AudioConnection          patchCord5(windLeft, 1, mixerLeft, 1);
+AudioConnection          patchCord6(windRight, 1, mixerRight, 1);
+AudioConnection          patchCord7(mixerLeft, 0, i2s1, 0);
+AudioConnection          patchCord8(mixerRight, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=480,350
+// GUItool: end automatically generated code
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(12);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  // outputs 0 and 1 are the surf, 2 and 3 the wind
+  noise1.pink(0, true);
+  noise1.pink(1, true);
+  noise1.amplitude(2, 0.5);
+  noise1.amplitude(3, 0.5);
+  windLeft.resonance(4.0);
+  windRight.resonance(4.0);
+
+  mixerLeft.gain(0, 1.0);
+  mixerRight.gain(0, 1.0);
+  mixerLeft.gain(1, 0.4);
+  mixerRight.gain(1, 0.4);
+}
+
+float t = 0;
+
+void loop() {
+  // a wave every 8 seconds, slightly later on the right
+  float left = 0.5 - 0.5 * cosf(t * 2 * PI / 8.0);
+  float right = 0.5 - 0.5 * cosf((t - 0.3) * 2 * PI / 8.0);
+  noise1.amplitude(0, left * left * 0.8);
+  noise1.amplitude(1, right * right * 0.8);
+
+  // the wind wanders between 300 and 1500 Hz
+  windLeft.frequency(900 + 600 * sinf(t * 0.37) * sinf(t * 0.11));
+  windRight.frequency(900 + 600 * sinf(t * 0.29 + 1) * sinf(t * 0.13));
+
+  t = t + 0.02;
+  delay(20);
+}
@@ -0,0 +1,71 @@
+// Six string guitar, with Karplus-Strong plucked strings
+//
+// One AudioSynthStringBank plays all six strings.  Chords are
+// strummed from the low string to the high one.  With coupling
+// turned up, the strings which are not plucked ring along
+// quietly with the notes they share, like an acoustic guitar.
+//
+// Requires Teensy 3.2 or higher.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthStringBank     strings1;       //xy=150,150
+AudioOutputI2S           i2s1;           //xy=330,150
+AudioConnection          patchCord1(strings1, 0, i2s1, 0);
+AudioConnection          patchCord2(strings1, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=240,250
+// GUItool: end automatically generated code
+
+// 1024 samples per string, so the lowest note is 43 Hz
+DMAMEM int16_t stringMemory[6 * 1024];
+
+// frequencies of each string, 0 for strings not played
+const float Cmajor[6] = { 0, 130.81, 164.81, 196.00, 261.63, 329.63 };
+const float Gmajor[6] = { 98.00, 123.47, 146.83, 196.00, 246.94, 392.00 };
+const float Aminor[6] = { 0, 110.00, 164.81, 220.00, 261.63, 329.63 };
+const float Fmajor[6] = { 87.31, 130.81, 174.61, 220.00, 261.63, 349.23 };
+// the open strings, E A D G B E
+const float openStrings[6] = { 82.41, 110.00, 146.83, 196.00, 246.94, 329.63 };
+
+void strum(const float *chord, float velocity) {
+  for (int i=0; i < 6; i++) {
+    if (chord[i] > 0) {
+      strings1.noteOn(i, chord[i], velocity);
+    } else {
+      // a string not played is left open, to ring along
+      strings1.tune(i, openStrings[i]);
+    }
+    delay(15);
+  }
+}
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(6);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  strings1.begin(stringMemory, 6 * 1024, 6);
+  strings1.decay(4.0);
+  strings1.damping(0.4);
+  strings1.coupling(0.3);
+  strings1.amplitude(0.7);
+}
+
+void loop() {
+  strum(Cmajor, 0.9);
+  delay(1000);
+  strum(Gmajor, 0.8);
+  delay(1000);
+  strum(Aminor, 0.9);
+  delay(1000);
+  strum(Fmajor, 0.8);
+  delay(1000);
+}
@@ -0,0 +1,95 @@
+// Supersaw: seven detuned sawtooth waves in one object
+//
+// AudioSynthWaveformUnison plays many copies of one band limited
+// waveform, each slightly out of tune and spread across the
+// stereo field, for the thick "supersaw" sound of trance and
+// synthwave pads.  This example plays chords, and slowly widens
+// the detune and stereo spread.
+//
+// Requires Teensy 4.x, which has the stack needed to build the
+// sawtooth's tables.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthWaveformUnison unison1;        //xy=150,100
+AudioSynthWaveformUnison unison2;        //xy=150,160
+AudioSynthWaveformUnison unison3;        //xy=150,220
+AudioMixer4              mixerLeft;      //xy=350,130
+AudioMixer4              mixerRight;     //xy=350,200
+AudioOutputI2S           i2s1;           //xy=520,160
+AudioConnection          patchCord1(unison1, 0, mixerLeft, 0);
+AudioConnection          patchCord2(unison1, 1, mixerRight, 0);
+AudioConnection          patchCord3(unison2, 0, mixerLeft, 1);
+AudioConnection          patchCord4(unison2, 1, mixerRight, 1);
+AudioConnection          patchCord5(unison3, 0, mixerLeft, 2);
+AudioConnection          patchCord6(unison3, 1, mixerRight, 2);
+AudioConnection          patchCord7(mixerLeft, 0, i2s1, 0);
+AudioConnection          patchCord8(mixerRight, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=350,300
+// GUItool: end automatically generated code
+
+// one sawtooth, shared by all three oscillators
+DMAMEM int16_t sawMemory[5386];
+AudioWaveformMipmap sawtooth;
+
+AudioSynthWaveformUnison *notes[3] = { &unison1, &unison2, &unison3 };
+
+// three note chords: A minor, F major, C major, G major
+const float chords[4][3] = {
+  { 220.00, 261.63, 329.63 },
+  { 174.61, 220.00, 261.63 },
+  { 196.00, 261.63, 329.63 },
+  { 196.00, 246.94, 293.66 },
+};
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.4);
+
+  if (!sawtooth.begin(WAVEFORM_SAWTOOTH, sawMemory, 5386)) {
+    while (1) {
+      Serial.println("Unable to build the sawtooth");
+      delay(500);
+    }
+  }
+  for (int i=0; i < 3; i++) {
+    notes[i]->voices(7);
+    notes[i]->begin(0.3, chords[0][i], sawtooth);
+    mixerLeft.gain(i, 0.33);
+    mixerRight.gain(i, 0.33);
+  }
+}
+
+float detune = 5;
+float spread = 0;
+
+void loop() {
+  for (int c=0; c < 4; c++) {
+    Serial.print("detune ");
+    Serial.print(detune);
+    Serial.print(" cents, spread ");
+    Serial.println(spread);
+    for (int i=0; i < 3; i++) {
+      notes[i]->detune(detune);
+      notes[i]->spread(spread);
+      notes[i]->frequency(chords[c][i]);
+    }
+    delay(1500);
+  }
+  // wider each time around, then start again
+  detune = detune + 10;
+  spread = spread + 0.25;
+  if (detune > 45) {
+    detune = 5;
+    spread = 0;
+  }
+}
@@ -0,0 +1,88 @@
+// Wavetable oscillator, morphing smoothly between waveforms
+//
+// Four single cycle waveforms, sine, triangle, square and
+// sawtooth, are drawn into an array and turned into band
+// limited tables by AudioWaveformMipmap, so high notes do not
+// alias.  AudioSynthWaveformMorph crossfades between them.  The
+// morph position is swept by a slow sine wave on input 1, while
+// loop() plays a bass line.
+//
+// Requires Teensy 4.x, which has the stack needed to build the
+// tables.
+//
+// This example code is in the public domain.
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthWaveform       lfo;            //xy=100,180
+AudioSynthWaveformMorph  morph1;         //xy=260,150
+AudioFilterStateVariable filter1;        //xy=420,150
+AudioOutputI2S           i2s1;           //xy=580,150
+AudioConnection          patchCord1(lfo, 0, morph1, 1);
+AudioConnection          patchCord2(morph1, 0, filter1, 0);
+AudioConnection          patchCord3(filter1, 0, i2s1, 0);
+AudioConnection          patchCord4(filter1, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=420,260
+// GUItool: end automatically generated code
+
+#define FRAME_LENGTH 256
+#define FRAMES       4
+
+int16_t frames[FRAMES * FRAME_LENGTH];
+// AudioWaveformMipmap::memoryRequired(256, 4) is 7196 words
+DMAMEM int16_t tableMemory[7196];
+AudioWaveformMipmap waveforms;
+
+void drawFrames() {
+  for (int i=0; i < FRAME_LENGTH; i++) {
+    float x = (float)i / FRAME_LENGTH;   // 0 to 1, one cycle
+    int16_t *f = frames;
+    // sine
+    f[i] = 32767 * sinf(2 * PI * x);
+    f += FRAME_LENGTH;
+    // triangle
+    f[i] = 32767 * (x < 0.5 ? 1 - 4 * fabsf(x - 0.25) : 4 * fabsf(x - 0.75) - 1);
+    f += FRAME_LENGTH;
+    // square
+    f[i] = x < 0.5 ? 32767 : -32767;
+    f += FRAME_LENGTH;
+    // sawtooth
+    f[i] = 32767 * (1 - 2 * x);
+  }
+}
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(8);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  drawFrames();
+  if (!waveforms.begin(frames, FRAME_LENGTH, FRAMES, tableMemory, sizeof(tableMemory) / 2)) {
+    while (1) {
+      Serial.println("Unable to build the wavetables");
+      delay(500);
+    }
+  }
+  morph1.begin(0.6, 110, waveforms);
+  // the morph position is 0.5, plus or minus 0.5 from the lfo
+  morph1.morph(0.5);
+  lfo.begin(0.5, 0.1, WAVEFORM_SINE);
+
+  filter1.frequency(3000);
+  filter1.resonance(1.2);
+}
+
+const float bassline[8] = { 55, 55, 110, 55, 65.41, 73.42, 110, 82.41 };
+
+void loop() {
+  for (int i=0; i < 8; i++) {
+    morph1.frequency(bassline[i]);
+    delay(200);
+  }
+}
@@ -0,0 +1,82 @@
+/* Play two instruments, many notes at once, from one object.
+
+   AudioSynthWavetablePoly holds up to 64 wavetable voices and
+   a different instrument on each MIDI channel, so a whole
+   arrangement needs no array of AudioSynthWavetable objects
+   and mixers.  Here channel 1 plays pizzicato arpeggios over
+   sustained viola chords on channel 2.
+
+   To play from your computer instead, set Tools > USB Type
+   to MIDI and call usbMIDI.setHandleNoteOn() with a function
+   that calls wavetable.noteOn(channel, note, velocity).
+
+   Requires Teensy 3.6 or higher.
+   Requires Audio Shield: https://www.pjrc.com/store/teensy3_audio.html
+*/
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+#include "Pizzicato_samples.h"
+#include "Viola_samples.h"
+
+AudioSynthWavetablePoly  wavetable;
+AudioOutputI2S           i2s1;
+AudioConnection          patchCord1(wavetable, 0, i2s1, 0);
+AudioConnection          patchCord2(wavetable, 1, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;
+
+// root notes of the chords, one per bar
+const int chords[] = { 57, 53, 48, 55 };
+// arpeggio pattern, in semitones above the root
+const int arpeggio[] = { 12, 16, 19, 24, 19, 16, 12, 7 };
+
+void setup() {
+  Serial.begin(115200);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.6);
+
+  wavetable.setInstrument(1, Pizzicato);
+  wavetable.setInstrument(2, Viola);
+  wavetable.pan(1, 0.4);     // pizzicato a little to the right
+  wavetable.pan(2, -0.4);    // viola a little to the left
+  wavetable.channelVolume(2, 0.5);
+  wavetable.amplitude(0.8);
+}
+
+int bar = 0;
+int chord = 0;  // root of the viola chord playing
+int step = 0;
+elapsedMillis msec;
+
+void loop() {
+  if (msec >= 200) {
+    msec = 0;
+    int root = chords[bar];
+    if (step == 0) {
+      // a new bar: change the viola chord
+      if (chord > 0) {
+        wavetable.noteOff(2, chord);
+        wavetable.noteOff(2, chord + 4);
+        wavetable.noteOff(2, chord + 7);
+      }
+      chord = root;
+      wavetable.noteOn(2, root, 70);
+      wavetable.noteOn(2, root + 4, 70);
+      wavetable.noteOn(2, root + 7, 70);
+    }
+    // pizzicato notes end by themselves, no noteOff needed
+    wavetable.noteOn(1, root + arpeggio[step], 100);
+
+    step = step + 1;
+    if (step >= 8) {
+      step = 0;
+      bar = bar + 1;
+      if (bar >= 4) bar = 0;
+    }
+  }
+}
@@ -0,0 +1,105 @@
+/* Play an instrument too large for program memory, from the SD card.
+
+   Only the start and the loop of each sample are loaded into
+   memory.  The rest is read from the card while each note
+   plays, so a multi-megabyte piano needs well under a megabyte
+   of RAM.
+
+   Make the instrument file with the wavetable2stream program,
+   in the library's extras folder, from a SoundFont decoder
+   .cpp file, and copy it to the SD card as PIANO.WTS.  The
+   converter prints the memory the instrument needs.
+
+   Requires Teensy 4.1 with PSRAM, or Teensy 4.0 for instruments
+   which fit in DMAMEM.
+   Requires Audio Shield: https://www.pjrc.com/store/teensy3_audio.html
+
+   This example code is in the public domain.
+*/
+
+#include <Audio.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SerialFlash.h>
+
+// GUItool: begin automatically generated code
+AudioSynthWavetableStream wavetable1;    //xy=150,100
+AudioSynthWavetableStream wavetable2;    //xy=150,150
+AudioSynthWavetableStream wavetable3;    //xy=150,200
+AudioSynthWavetableStream wavetable4;    //xy=150,250
+AudioMixer4              mixer1;         //xy=350,175
+AudioOutputI2S           i2s1;           //xy=520,175
+AudioConnection          patchCord1(wavetable1, 0, mixer1, 0);
+AudioConnection          patchCord2(wavetable2, 0, mixer1, 1);
+AudioConnection          patchCord3(wavetable3, 0, mixer1, 2);
+AudioConnection          patchCord4(wavetable4, 0, mixer1, 3);
+AudioConnection          patchCord5(mixer1, 0, i2s1, 0);
+AudioConnection          patchCord6(mixer1, 0, i2s1, 1);
+AudioControlSGTL5000     sgtl5000_1;     //xy=350,300
+// GUItool: end automatically generated code
+
+// The preloaded part of the instrument.  All the voices share it.
+AudioWavetableStreamInstrument piano;
+EXTMEM uint8_t pianoMemory[1024 * 1024];
+//DMAMEM uint8_t pianoMemory[200 * 1024];   // Teensy 4.0
+
+AudioSynthWavetableStream *voices[4] = {
+  &wavetable1, &wavetable2, &wavetable3, &wavetable4
+};
+
+// Use these with the Teensy Audio Shield
+#define SDCARD_CS_PIN    10
+#define SDCARD_MOSI_PIN  7   // Teensy 4 ignores this, uses pin 11
+#define SDCARD_SCK_PIN   14  // Teensy 4 ignores this, uses pin 13
+
+// Use these with the Teensy 4.1 SD card
+//#define SDCARD_CS_PIN    BUILTIN_SDCARD
+//#define SDCARD_MOSI_PIN  11  // not actually used
+//#define SDCARD_SCK_PIN   13  // not actually used
+
+void setup() {
+  Serial.begin(9600);
+  AudioMemory(10);
+  sgtl5000_1.enable();
+  sgtl5000_1.volume(0.5);
+
+  SPI.setMOSI(SDCARD_MOSI_PIN);
+  SPI.setSCK(SDCARD_SCK_PIN);
+  if (!(SD.begin(SDCARD_CS_PIN))) {
+    // stop here, but print a message repetitively
+    while (1) {
+      Serial.println("Unable to access the SD card");
+      delay(500);
+    }
+  }
+  if (!piano.loadSD("PIANO.WTS", pianoMemory, sizeof(pianoMemory))) {
+    while (1) {
+      Serial.print("Unable to load PIANO.WTS, it needs ");
+      Serial.print(piano.memoryRequired());
+      Serial.println(" bytes of memory");
+      delay(500);
+    }
+  }
+  for (int i=0; i < 4; i++) {
+    voices[i]->setInstrument(piano);
+    mixer1.gain(i, 0.25);
+  }
+}
+
+// a C major chord, one note per voice, moving up and down an octave
+const int notes[] = { 48, 55, 64, 72 };
+int octave = 0;
+
+void loop() {
+  for (int i=0; i < 4; i++) {
+    voices[i]->playNote(notes[i] + octave, 100);
+    delay(150);
+  }
+  delay(1500);
+  for (int i=0; i < 4; i++) {
+    voices[i]->stop();
+  }
+  delay(500);
+  octave = (octave == 0) ? 12 : 0;
+}
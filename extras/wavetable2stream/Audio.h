@@ -0,0 +1,59 @@
+// Stand-in for the Audio library's Audio.h, so SoundFont decoder output
+// can be compiled on a PC by wavetable2stream.  Only the parts used by
+// the decoder's files are defined here.
+
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+#ifndef AUDIO_SAMPLE_RATE_EXACT
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706 // must match the Teensy's rate
+#endif
+#define AUDIO_BLOCK_SAMPLES 128
+#define PROGMEM
+
+#define WAVETABLE_CENTS_SHIFT(C) (pow(2.0, (C)/1200.0))
+#define WAVETABLE_NOTE_TO_FREQUENCY(N) (440.0 * pow(2.0, ((N) - 69) / 12.0))
+#define WAVETABLE_DECIBEL_SHIFT(dB) (pow(10.0, (dB)/20.0))
+
+class AudioSynthWavetable
+{
+public:
+	struct sample_data {
+		const int16_t* sample;
+		const bool LOOP;
+		const int INDEX_BITS;
+		const float PER_HERTZ_PHASE_INCREMENT;
+		const uint32_t MAX_PHASE;
+		const uint32_t LOOP_PHASE_END;
+		const uint32_t LOOP_PHASE_LENGTH;
+		const uint16_t INITIAL_ATTENUATION_SCALAR;
+		const uint32_t DELAY_COUNT;
+		const uint32_t ATTACK_COUNT;
+		const uint32_t HOLD_COUNT;
+		const uint32_t DECAY_COUNT;
+		const uint32_t RELEASE_COUNT;
+		const int32_t SUSTAIN_MULT;
+		const uint32_t VIBRATO_DELAY;
+		const uint32_t VIBRATO_INCREMENT;
+		const float VIBRATO_PITCH_COEFFICIENT_INITIAL;
+		const float VIBRATO_PITCH_COEFFICIENT_SECOND;
+		const uint32_t MODULATION_DELAY;
+		const uint32_t MODULATION_INCREMENT;
+		const float MODULATION_PITCH_COEFFICIENT_INITIAL;
+		const float MODULATION_PITCH_COEFFICIENT_SECOND;
+		const int32_t MODULATION_AMPLITUDE_INITIAL_GAIN;
+		const int32_t MODULATION_AMPLITUDE_SECOND_GAIN;
+	};
+	static const int32_t UNITY_GAIN = INT32_MAX;
+	static constexpr float SAMPLES_PER_MSEC = (AUDIO_SAMPLE_RATE_EXACT/1000.0f);
+	static const int32_t LFO_SMOOTHNESS = 3;
+	static constexpr float LFO_PERIOD = (AUDIO_BLOCK_SAMPLES/(1 << (LFO_SMOOTHNESS-1)));
+	static const int32_t ENVELOPE_PERIOD = 8;
+
+	struct instrument_data {
+		const uint8_t sample_count;
+		const uint8_t* sample_note_ranges;
+		const sample_data* samples;
+	};
+};
@@ -0,0 +1,193 @@
+// Convert a SoundFont decoder instrument to a streaming wavetable file
+// for AudioWavetableStreamInstrument, to play from SD or SerialFlash
+// Copyright 2026, Paul Stoffregen (paul@pjrc.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// The decoder's .cpp and .h files are compiled into this program, using
+// the Audio.h in this directory, so the instrument is converted exactly
+// as the Teensy would compute it.  For an instrument named "piano":
+//
+// compile with:  g++ -O2 -Wall -I. -include path/piano_samples.h
+//                    -DINSTRUMENT=piano -o piano2stream
+//                    wavetable2stream.cpp path/piano_samples.cpp
+// run with:      ./piano2stream [-a samples] piano.wts
+//
+// The first samples of each sample (2048 by default, about 46 ms) and
+// its loop are preloaded into memory when the file is loaded.  A longer
+// attack uses more memory; a shorter one leaves less time to start
+// reading the rest.  The decoder's size limit can be turned off, since
+// the sample data no longer needs to fit in program memory.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#ifndef INSTRUMENT
+#error "define INSTRUMENT as the name of the decoder's instrument_data"
+#endif
+
+#define HEADER_SIZE  16
+#define RECORD_SIZE  128
+#define SECTOR_SIZE  512
+
+static void put32(std::vector<uint8_t> &out, uint32_t n)
+{
+	out.push_back(n);
+	out.push_back(n >> 8);
+	out.push_back(n >> 16);
+	out.push_back(n >> 24);
+}
+
+static void putfloat(std::vector<uint8_t> &out, float f)
+{
+	uint32_t n;
+	memcpy(&n, &f, 4);
+	put32(out, n);
+}
+
+// append samples first to last inclusive, padded to a multiple of 4 bytes
+static uint32_t putsamples(std::vector<uint8_t> &out, const int16_t *data, uint32_t first, uint32_t last)
+{
+	uint32_t offset = out.size();
+	for (uint32_t i=first; i <= last; i++) {
+		out.push_back(data[i]);
+		out.push_back(data[i] >> 8);
+	}
+	while (out.size() & 3) out.push_back(0);
+	return offset;
+}
+
+int main(int argc, char **argv)
+{
+	const AudioSynthWavetable::instrument_data &inst = INSTRUMENT;
+	uint32_t attack = 2048;
+	const char *filename = NULL;
+
+	for (int i=1; i < argc; i++) {
+		if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+			attack = atoi(argv[++i]);
+		} else if (argv[i][0] != '-' && filename == NULL) {
+			filename = argv[i];
+		} else {
+			filename = NULL;
+			break;
+		}
+	}
+	if (filename == NULL) {
+		fprintf(stderr, "usage: %s [-a attack_samples] output.wts\n", argv[0]);
+		return 1;
+	}
+
+	uint32_t count = inst.sample_count;
+	std::vector<uint8_t> records, preload, body;
+	for (uint32_t i=0; i < count; i++) {
+		const AudioSynthWavetable::sample_data &s = inst.samples[i];
+		const int shift = 32 - s.INDEX_BITS;
+		uint32_t last = s.MAX_PHASE >> shift;
+		uint32_t loop_start = 0, loop_end = 0;
+		// everything before the loop, or the whole sample, is streamed
+		// after the attack, including one sample past the end for the
+		// interpolation
+		uint32_t stream_end = last;
+		if (s.LOOP) {
+			loop_end = s.LOOP_PHASE_END >> shift;
+			loop_start = (s.LOOP_PHASE_END - s.LOOP_PHASE_LENGTH) >> shift;
+			stream_end = loop_start;
+		}
+		uint32_t attack_length = attack < stream_end ? attack : stream_end;
+		uint32_t attack_offset = putsamples(preload, s.sample, 0, attack_length);
+		uint32_t loop_offset = s.LOOP ? putsamples(preload, s.sample, loop_start, loop_end) : 0;
+		uint32_t body_offset = 0, body_length = 0;
+		if (stream_end > attack_length) {
+			body_offset = body.size();
+			body_length = stream_end - attack_length + 1;
+			putsamples(body, s.sample, attack_length, stream_end);
+			while (body.size() % SECTOR_SIZE) body.push_back(0);
+		}
+
+		put32(records, s.LOOP ? 1 : 0);
+		put32(records, s.INDEX_BITS);
+		putfloat(records, s.PER_HERTZ_PHASE_INCREMENT);
+		put32(records, s.MAX_PHASE);
+		put32(records, s.LOOP_PHASE_END);
+		put32(records, s.LOOP_PHASE_LENGTH);
+		put32(records, s.INITIAL_ATTENUATION_SCALAR);
+		put32(records, s.DELAY_COUNT);
+		put32(records, s.ATTACK_COUNT);
+		put32(records, s.HOLD_COUNT);
+		put32(records, s.DECAY_COUNT);
+		put32(records, s.RELEASE_COUNT);
+		put32(records, s.SUSTAIN_MULT);
+		put32(records, s.VIBRATO_DELAY);
+		put32(records, s.VIBRATO_INCREMENT);
+		putfloat(records, s.VIBRATO_PITCH_COEFFICIENT_INITIAL);
+		putfloat(records, s.VIBRATO_PITCH_COEFFICIENT_SECOND);
+		put32(records, s.MODULATION_DELAY);
+		put32(records, s.MODULATION_INCREMENT);
+		putfloat(records, s.MODULATION_PITCH_COEFFICIENT_INITIAL);
+		putfloat(records, s.MODULATION_PITCH_COEFFICIENT_SECOND);
+		put32(records, s.MODULATION_AMPLITUDE_INITIAL_GAIN);
+		put32(records, s.MODULATION_AMPLITUDE_SECOND_GAIN);
+		put32(records, attack_length);
+		put32(records, loop_start);
+		put32(records, attack_offset);
+		put32(records, loop_offset);
+		put32(records, body_offset); // relative to the body, fixed below
+		put32(records, body_length);
+		while (records.size() % RECORD_SIZE) put32(records, 0);
+	}
+
+	std::vector<uint8_t> out;
+	out.insert(out.end(), "WTS1", "WTS1" + 4);
+	put32(out, count);
+	put32(out, preload.size());
+	put32(out, 0);
+	for (uint32_t i=0; i < count; i++) out.push_back(inst.sample_note_ranges[i]);
+	while (out.size() & 3) out.push_back(0);
+	uint32_t records_offset = out.size();
+	out.insert(out.end(), records.begin(), records.end());
+	out.insert(out.end(), preload.begin(), preload.end());
+	while (out.size() % SECTOR_SIZE) out.push_back(0);
+	uint32_t body_start = out.size();
+	out.insert(out.end(), body.begin(), body.end());
+	for (uint32_t i=0; i < count; i++) {
+		uint8_t *p = &out[records_offset + i * RECORD_SIZE + 108];
+		uint32_t n = (p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)) + body_start;
+		p[0] = n;
+		p[1] = n >> 8;
+		p[2] = n >> 16;
+		p[3] = n >> 24;
+	}
+
+	FILE *f = fopen(filename, "wb");
+	if (f == NULL || fwrite(out.data(), 1, out.size(), f) != out.size()) {
+		fprintf(stderr, "unable to write %s\n", filename);
+		return 1;
+	}
+	fclose(f);
+	// an upper bound on sizeof(sample_data) keeps this independent of the board
+	uint32_t memory = ((count + 7) & ~7) + count * RECORD_SIZE + preload.size();
+	printf("%s: %u samples, %u bytes, %u bytes streamed\n", filename,
+		count, (unsigned)out.size(), (unsigned)body.size());
+	printf("memory needed: %u bytes\n", memory);
+	return 0;
+}
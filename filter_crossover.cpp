@@ -0,0 +1,169 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "filter_crossover.h"
+#include "biquad.h"
+#include "utility/dspinst.h"
+
+// default crossover points, used until frequency() is called
+static const float default_frequency[CROSSOVER_MAX_BANDS-1] = {
+	200.0f, 1000.0f, 3000.0f, 8000.0f
+};
+
+AudioFilterCrossover::AudioFilterCrossover(uint8_t channels)
+  : AudioStream(channels > CROSSOVER_MAX_CHANNELS ? CROSSOVER_MAX_CHANNELS :
+	(channels < 1 ? 1 : channels), inputQueueArray)
+{
+	num_channels = num_inputs;
+	num_splits = 1;
+	state = new state_t[num_channels];
+	memset(state, 0, sizeof(state_t) * num_channels);
+	for (int i=0; i < MAX_SPLITS; i++) {
+		frequencies[i] = default_frequency[i];
+	}
+	design(num_splits);
+}
+
+AudioFilterCrossover::~AudioFilterCrossover()
+{
+	delete [] state;
+}
+
+void AudioFilterCrossover::bands(uint8_t n)
+{
+	if (n < 2) n = 2;
+	else if (n > CROSSOVER_MAX_BANDS) n = CROSSOVER_MAX_BANDS;
+	uint32_t old_splits = num_splits;
+	uint32_t splits = n - 1;
+	if (splits == old_splits) return;
+	design(splits);
+	__disable_irq();
+	// crossovers coming back into use must not start with old state
+	for (uint32_t ch=0; ch < num_channels; ch++) {
+		state_t *st = state + ch;
+		for (uint32_t s=old_splits; s < splits; s++) {
+			memset(st->lowpass[s], 0, sizeof(st->lowpass[s]));
+			memset(st->highpass[s], 0, sizeof(st->highpass[s]));
+			memset(st->allpass[s], 0, sizeof(st->allpass[s]));
+			for (uint32_t b=0; b < s; b++) {
+				st->allpass[b][s][0] = 0.0f;
+				st->allpass[b][s][1] = 0.0f;
+			}
+		}
+	}
+	num_splits = splits;
+	__enable_irq();
+}
+
+void AudioFilterCrossover::frequency(uint8_t n, float freq)
+{
+	if (n >= MAX_SPLITS) return;
+	if (freq < 10.0f) freq = 10.0f;
+	else if (freq > AUDIO_SAMPLE_RATE_EXACT * 0.45f) freq = AUDIO_SAMPLE_RATE_EXACT * 0.45f;
+	frequencies[n] = freq;
+	design(num_splits);
+}
+
+// Compute the coefficients for the first splits crossovers, lowest first.
+void AudioFilterCrossover::design(uint32_t splits)
+{
+	coefficients_t c[MAX_SPLITS];
+	float sorted[MAX_SPLITS];
+	uint32_t i, j;
+
+	for (i=0; i < splits; i++) {
+		float f = frequencies[i];
+		for (j=i; j > 0 && sorted[j-1] > f; j--) sorted[j] = sorted[j-1];
+		sorted[j] = f;
+	}
+	for (i=0; i < splits; i++) {
+		// LR4 is a pair of Butterworth (Q = 0.7071) sections, and the sum
+		// of its lowpass and highpass outputs is a 2nd order allpass at
+		// the same Q
+		getCoefficients(c[i].lowpass, BiquadType::LOW_PASS, 0.0, sorted[i], AUDIO_SAMPLE_RATE_EXACT, M_SQRT1_2);
+		getCoefficients(c[i].highpass, BiquadType::HIGH_PASS, 0.0, sorted[i], AUDIO_SAMPLE_RATE_EXACT, M_SQRT1_2);
+		getCoefficients(c[i].allpass, BiquadType::ALL_PASS, 0.0, sorted[i], AUDIO_SAMPLE_RATE_EXACT, M_SQRT1_2);
+	}
+	__disable_irq();
+	for (i=0; i < splits; i++) coef[i] = c[i];
+	__enable_irq();
+}
+
+// transposed direct form II, coefficients are b0, b1, b2, -a1, -a2
+static inline float biquad(const float *c, float *z, float x) __attribute__((always_inline, unused));
+static inline float biquad(const float *c, float *z, float x)
+{
+	float y = c[0] * x + z[0];
+	z[0] = c[1] * x + c[3] * y + z[1];
+	z[1] = c[2] * x + c[4] * y;
+	return y;
+}
+
+void AudioFilterCrossover::update(void)
+{
+	audio_block_t *in, *out[CROSSOVER_MAX_BANDS];
+	const uint32_t splits = num_splits;
+	uint32_t ch, i, s, j;
+
+	for (ch=0; ch < num_channels; ch++) {
+		in = receiveReadOnly(ch);
+		if (!in) continue;
+		for (s=0; s <= splits; s++) {
+			out[s] = allocate();
+			if (!out[s]) {
+				while (s > 0) release(out[--s]);
+				release(in);
+				return;
+			}
+		}
+		state_t *st = state + ch;
+		// every sample travels the whole crossover tree before the next
+		// one is read, so the input block is only fetched once
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			float x = in->data[i];
+			for (s=0; s < splits; s++) {
+				const coefficients_t *c = coef + s;
+				float lo = biquad(c->lowpass, st->lowpass[s][0], x);
+				lo = biquad(c->lowpass, st->lowpass[s][1], lo);
+				float hi = biquad(c->highpass, st->highpass[s][0], x);
+				x = biquad(c->highpass, st->highpass[s][1], hi);
+				// phase compensate for the crossovers above this band
+				for (j=s+1; j < splits; j++) {
+					lo = biquad(coef[j].allpass, st->allpass[s][j], lo);
+				}
+				out[s]->data[i] = saturate16((int32_t)lo);
+			}
+			out[splits]->data[i] = saturate16((int32_t)x);
+		}
+		release(in);
+		for (s=0; s <= splits; s++) {
+			transmit(out[s], ch * CROSSOVER_MAX_BANDS + s);
+			release(out[s]);
+		}
+	}
+}
@@ -0,0 +1,81 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef filter_crossover_h_
+#define filter_crossover_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Linkwitz-Riley (LR4) multiband crossover.  One input is split into 2 to 5
+// bands in a single pass.  Each crossover point is a pair of cascaded 2nd
+// order Butterworth lowpass and highpass sections; lower bands also pass
+// through the allpass equivalent of every higher crossover, so the band
+// outputs always sum back to an allpass response.
+//
+// Up to 8 channels can share one object (and one set of coefficients).
+// Outputs are numbered channel * CROSSOVER_MAX_BANDS + band, so a mono
+// crossover uses outputs 0 to 4, lowest band first.
+
+#define CROSSOVER_MAX_BANDS    5
+#define CROSSOVER_MAX_CHANNELS 8
+
+class AudioFilterCrossover : public AudioStream
+{
+public:
+	AudioFilterCrossover(uint8_t channels = 1);
+	~AudioFilterCrossover();
+	virtual void update(void);
+
+	// number of bands produced, 2 to 5
+	void bands(uint8_t n);
+	// crossover point n, 0 to 3.  The crossovers in use are sorted, so
+	// band 0 is always below the lowest frequency, whatever order they
+	// are given in.
+	void frequency(uint8_t n, float freq);
+private:
+	enum { MAX_SPLITS = CROSSOVER_MAX_BANDS - 1 };
+	struct coefficients_t {
+		float lowpass[5];   // b0, b1, b2, -a1, -a2
+		float highpass[5];
+		float allpass[5];
+	};
+	struct state_t {
+		float lowpass[MAX_SPLITS][2][2];  // two cascaded sections
+		float highpass[MAX_SPLITS][2][2];
+		float allpass[MAX_SPLITS][MAX_SPLITS][2]; // [band][crossover]
+	};
+	void design(uint32_t splits);
+	coefficients_t coef[MAX_SPLITS];
+	float frequencies[MAX_SPLITS]; // as given, not sorted
+	state_t *state;
+	uint8_t num_channels;
+	volatile uint8_t num_splits;
+	audio_block_t *inputQueueArray[CROSSOVER_MAX_CHANNELS];
+};
+
+#endif
@@ -0,0 +1,167 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "filter_equalizer.h"
+
+// calcBiquad() returns fixed point coefficients, scaled by half its
+// quantization unit.  Boost and shelving filters can have coefficients
+// well above 2.0, so 2^27 is used to leave headroom for about +/- 30 dB
+// while still exceeding the precision of a float.
+#define EQUALIZER_QUANTIZATION 134217728
+#define EQUALIZER_SCALE (2.0f / (float)EQUALIZER_QUANTIZATION)
+
+AudioFilterEqualizer::AudioFilterEqualizer(void) : AudioStream(1, inputQueueArray)
+{
+	memset(params, 0, sizeof(params));
+	// bands not yet set up are flat peaking filters, so gain() on one
+	// adds a 1 kHz peak rather than a lowpass
+	for (int i=0; i < EQUALIZER_MAX_BANDS; i++) {
+		params[i].frequency = 1000.0f;
+		params[i].q = 1.4142f;
+		params[i].type = FILTER_PARAEQ;
+	}
+	memset(coefficients, 0, sizeof(coefficients));
+	memset(state, 0, sizeof(state));
+	memset(packed_state, 0, sizeof(packed_state));
+	arm_biquad_cascade_df2T_init_f32(&cascade, 0, packed_coefficients, packed_state);
+}
+
+void AudioFilterEqualizer::band(uint8_t n, float frequency, float gain, float q, uint8_t type)
+{
+	int coef[5];
+	float c[5];
+
+	if (n >= EQUALIZER_MAX_BANDS || type > FILTER_HISHELF) return;
+	if (frequency < 10.0f) frequency = 10.0f;
+	else if (frequency > AUDIO_SAMPLE_RATE_EXACT * 0.49f) frequency = AUDIO_SAMPLE_RATE_EXACT * 0.49f;
+	if (q < 0.05f) q = 0.05f;
+	if (gain > 30.0f) gain = 30.0f;
+	else if (gain < -30.0f) gain = -30.0f;
+	// peaking and shelving filters do nothing at 0 dB, so skip them
+	bool active = (type < FILTER_PARAEQ) || (fabsf(gain) >= 0.01f);
+	if (active) {
+		calcBiquad(type, frequency, gain, q, EQUALIZER_QUANTIZATION,
+			AUDIO_SAMPLE_RATE_EXACT, coef);
+		for (int i=0; i < 5; i++) c[i] = (float)coef[i] * EQUALIZER_SCALE;
+	}
+	__disable_irq();
+	if (active) {
+		if (!params[n].active) {
+			state[n][0] = 0.0f;
+			state[n][1] = 0.0f;
+		}
+		memcpy(coefficients[n], c, sizeof(c));
+	}
+	params[n].frequency = frequency;
+	params[n].gain = gain;
+	params[n].q = q;
+	params[n].type = type;
+	params[n].active = active;
+	pack();
+	__enable_irq();
+}
+
+void AudioFilterEqualizer::graphic(uint8_t count, float lowFreq, float highFreq)
+{
+	if (count > EQUALIZER_MAX_BANDS) count = EQUALIZER_MAX_BANDS;
+	if (count < 1 || lowFreq <= 0.0f || highFreq < lowFreq) return;
+	float ratio = 2.0f;
+	if (count > 1) ratio = powf(highFreq / lowFreq, 1.0f / (float)(count - 1));
+	// Q giving -3 dB points half way (on a log scale) to the next band
+	float q = sqrtf(ratio) / (ratio - 1.0f);
+	float freq = lowFreq;
+	for (int i=0; i < count; i++) {
+		band(i, freq, 0.0f, q, FILTER_PARAEQ);
+		freq *= ratio;
+	}
+	for (int i=count; i < EQUALIZER_MAX_BANDS; i++) {
+		disable(i);
+	}
+}
+
+void AudioFilterEqualizer::disable(uint8_t n)
+{
+	if (n >= EQUALIZER_MAX_BANDS) return;
+	__disable_irq();
+	params[n].gain = 0.0f;
+	params[n].active = false;
+	pack();
+	__enable_irq();
+}
+
+// must be called with interrupts disabled
+void AudioFilterEqualizer::pack(void)
+{
+	uint32_t i, stages = 0;
+
+	// return the running state to each band, so bands keep their
+	// state when others are added to or removed from the cascade
+	for (i=0; i < cascade.numStages; i++) {
+		state[packed_band[i]][0] = packed_state[i*2];
+		state[packed_band[i]][1] = packed_state[i*2+1];
+	}
+	for (i=0; i < EQUALIZER_MAX_BANDS; i++) {
+		if (!params[i].active) continue;
+		memcpy(packed_coefficients + stages*5, coefficients[i], sizeof(coefficients[i]));
+		packed_state[stages*2] = state[i][0];
+		packed_state[stages*2+1] = state[i][1];
+		packed_band[stages++] = i;
+	}
+	cascade.numStages = stages;
+}
+
+void AudioFilterEqualizer::update(void)
+{
+	audio_block_t *block;
+	float buf[AUDIO_BLOCK_SAMPLES];
+	int i;
+
+	if (cascade.numStages == 0) {
+		// all bands flat, just pass the signal through
+		block = receiveReadOnly();
+		if (!block) return;
+		transmit(block);
+		release(block);
+		return;
+	}
+	block = receiveWritable();
+	if (!block) return;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		buf[i] = (float)block->data[i];
+	}
+	// all active bands run as one cascade, in place
+	arm_biquad_cascade_df2T_f32(&cascade, buf, buf, AUDIO_BLOCK_SAMPLES);
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		float y = buf[i];
+		if (y > 32767.0f) y = 32767.0f;
+		else if (y < -32768.0f) y = -32768.0f;
+		block->data[i] = (int16_t)y;
+	}
+	transmit(block);
+	release(block);
+}
@@ -0,0 +1,86 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef filter_equalizer_h_
+#define filter_equalizer_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include <arm_math.h>    // github.com/PaulStoffregen/cores/blob/master/teensy4/arm_math.h
+#include "control_sgtl5000.h" // calcBiquad() and FILTER_xxx types
+
+// Software graphic / parametric equalizer, for codecs without a built in
+// DSP.  Coefficients are designed with calcBiquad(), the same function used
+// for the SGTL5000 PEQ, and only recomputed when a band is changed.  Bands
+// which have no effect (peaking or shelving at 0 dB) are left out of the
+// cascade, so a flat EQ costs almost nothing.
+
+#define EQUALIZER_MAX_BANDS 31
+
+class AudioFilterEqualizer : public AudioStream
+{
+public:
+	AudioFilterEqualizer(void);
+	virtual void update(void);
+
+	// Configure a band with any calcBiquad() filter type, gain in dB
+	void band(uint8_t n, float frequency, float gain, float q = 1.4142f,
+		uint8_t type = FILTER_PARAEQ);
+	// Change only the gain of a band, eg. a graphic EQ slider.  A band
+	// never configured is a 1 kHz peaking filter.
+	void gain(uint8_t n, float gain) {
+		if (n >= EQUALIZER_MAX_BANDS) return;
+		if (gain == params[n].gain) return;
+		band(n, params[n].frequency, gain, params[n].q, params[n].type);
+	}
+	// Set up count peaking bands, spaced evenly on a log scale from
+	// lowFreq to highFreq, all at 0 dB.  graphic(10) gives a standard
+	// octave EQ, graphic(31, 20, 20000) a 1/3 octave EQ.
+	void graphic(uint8_t count, float lowFreq = 31.25f, float highFreq = 16000.0f);
+	// Remove a band from the cascade
+	void disable(uint8_t n);
+private:
+	struct band_t {
+		float frequency;
+		float gain;
+		float q;
+		uint8_t type;
+		bool active;
+	};
+	void pack(void);
+	band_t params[EQUALIZER_MAX_BANDS];
+	float coefficients[EQUALIZER_MAX_BANDS][5]; // b0, b1, b2, -a1, -a2
+	float state[EQUALIZER_MAX_BANDS][2];
+	// the active bands, packed contiguously for the CMSIS cascade
+	float packed_coefficients[EQUALIZER_MAX_BANDS*5];
+	float packed_state[EQUALIZER_MAX_BANDS*2];
+	uint8_t packed_band[EQUALIZER_MAX_BANDS];
+	arm_biquad_cascade_df2T_instance_f32 cascade;
+	audio_block_t *inputQueueArray[1];
+};
+
+#endif
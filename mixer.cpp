@@ -31,10 +31,10 @@
 #if defined(__ARM_ARCH_7EM__)
 #define MULTI_UNITYGAIN 65536
 
-static void applyGain(int16_t *data, int32_t mult)
+static void applyGain(int16_t *data, int32_t mult, int len = AUDIO_BLOCK_SAMPLES)
 {
 	uint32_t *p = (uint32_t *)data;
-	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+	const uint32_t *end = (uint32_t *)(data + len);
 
 	do {
 		uint32_t tmp32 = *p; // read 2 samples from *data
@@ -46,11 +46,12 @@ static void applyGain(int16_t *data, int32_t mult)
 	} while (p < end);
 }
 
-static void applyGainThenAdd(int16_t *data, const int16_t *in, int32_t mult)
+// len must be a multiple of 2, or of 4 at unity gain
+static void applyGainThenAdd(int16_t *data, const int16_t *in, int32_t mult, int len = AUDIO_BLOCK_SAMPLES)
 {
 	uint32_t *dst = (uint32_t *)data;
 	const uint32_t *src = (uint32_t *)in;
-	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+	const uint32_t *end = (uint32_t *)(data + len);
 
 	if (mult == MULTI_UNITYGAIN) {
 		do {
@@ -73,12 +74,15 @@ static void applyGainThenAdd(int16_t *data, const int16_t *in, int32_t mult)
 	}
 }
 
+// events take effect on a multiple of 4 samples, for the 2 sample loops
+#define EVENT_ALIGN 4
+
 #elif defined(KINETISL)
 #define MULTI_UNITYGAIN 256
 
-static void applyGain(int16_t *data, int32_t mult)
+static void applyGain(int16_t *data, int32_t mult, int len = AUDIO_BLOCK_SAMPLES)
 {
-	const int16_t *end = data + AUDIO_BLOCK_SAMPLES;
+	const int16_t *end = data + len;
 
 	do {
 		int32_t val = *data * mult;
@@ -86,9 +90,9 @@ static void applyGain(int16_t *data, int32_t mult)
 	} while (data < end);
 }
 
-static void applyGainThenAdd(int16_t *dst, const int16_t *src, int32_t mult)
+static void applyGainThenAdd(int16_t *dst, const int16_t *src, int32_t mult, int len = AUDIO_BLOCK_SAMPLES)
 {
-	const int16_t *end = dst + AUDIO_BLOCK_SAMPLES;
+	const int16_t *end = dst + len;
 
 	if (mult == MULTI_UNITYGAIN) {
 		do {
@@ -103,6 +107,8 @@ static void applyGainThenAdd(int16_t *dst, const int16_t *src, int32_t mult)
 	}
 }
 
+#define EVENT_ALIGN 1
+
 #endif
 
 void AudioMixer4::update(void)
@@ -110,6 +116,14 @@ void AudioMixer4::update(void)
 	audio_block_t *in, *out=NULL;
 	unsigned int channel;
 
+	if (event_queue) {
+		event_queue->beginBlock();
+		if (event_queue->nextOffset() < AUDIO_BLOCK_SAMPLES) {
+			updateWithEvents();
+			return;
+		}
+	}
+
 	for (channel=0; channel < 4; channel++) {
 		if (!out) {
 			out = receiveWritable(channel);
@@ -131,6 +145,49 @@ void AudioMixer4::update(void)
 	}
 }
 
+// A block with gain changes part way through is mixed in pieces
+void AudioMixer4::updateWithEvents(void)
+{
+	audio_block_t *in[4], *out;
+	audio_event_t event;
+	unsigned int channel;
+	int offset, next, due;
+
+	out = allocate();
+	if (out) memset(out->data, 0, sizeof(out->data));
+	for (channel=0; channel < 4; channel++) {
+		in[channel] = receiveReadOnly(channel);
+	}
+	if (out && !in[0] && !in[1] && !in[2] && !in[3]) {
+		release(out);
+		out = NULL;
+	}
+	offset = 0;
+	while (1) {
+		due = event_queue->nextOffset();
+		next = due & ~(EVENT_ALIGN - 1);
+		if (out && next > offset) {
+			for (channel=0; channel < 4; channel++) {
+				if (!in[channel]) continue;
+				applyGainThenAdd(out->data + offset, in[channel]->data + offset,
+					multiplier[channel], next - offset);
+			}
+		}
+		if (due >= AUDIO_BLOCK_SAMPLES) break;
+		while (event_queue->pop(due, event)) {
+			if (event.param == AUDIO_EVENT_GAIN) gain(event.index, event.value);
+		}
+		offset = next;
+	}
+	for (channel=0; channel < 4; channel++) {
+		if (in[channel]) release(in[channel]);
+	}
+	if (out) {
+		transmit(out);
+		release(out);
+	}
+}
+
 void AudioAmplifier::update(void)
 {
 	audio_block_t *block;
@@ -29,6 +29,7 @@
 
 #include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
 #include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include "event_queue.h"
 
 class AudioMixer4 : public AudioStream
 {
@@ -36,6 +37,7 @@ class AudioMixer4 : public AudioStream
 public:
 	AudioMixer4(void) : AudioStream(4, inputQueueArray) {
 		for (int i=0; i<4; i++) multiplier[i] = 65536;
+		event_queue = NULL;
 	}
 	virtual void update(void);
 	void gain(unsigned int channel, float gain) {
@@ -44,14 +46,22 @@ public:
 		else if (gain < -32767.0f) gain = -32767.0f;
 		multiplier[channel] = gain * 65536.0f; // TODO: proper roundoff?
 	}
+	// sample accurate AUDIO_EVENT_GAIN changes, posted to this queue,
+	// which take effect on a multiple of 4 samples
+	void eventQueue(AudioEventQueue &queue) {
+		event_queue = &queue;
+	}
 private:
+	void updateWithEvents(void);
 	int32_t multiplier[4];
 	audio_block_t *inputQueueArray[4];
+	AudioEventQueue *event_queue;
 
 #elif defined(KINETISL)
 public:
 	AudioMixer4(void) : AudioStream(4, inputQueueArray) {
 		for (int i=0; i<4; i++) multiplier[i] = 256;
+		event_queue = NULL;
 	}
 	virtual void update(void);
 	void gain(unsigned int channel, float gain) {
@@ -60,9 +70,15 @@ public:
 		else if (gain < -127.0f) gain = -127.0f;
 		multiplier[channel] = gain * 256.0f; // TODO: proper roundoff?
 	}
+	// sample accurate AUDIO_EVENT_GAIN changes, posted to this queue
+	void eventQueue(AudioEventQueue &queue) {
+		event_queue = &queue;
+	}
 private:
+	void updateWithEvents(void);
 	int16_t multiplier[4];
 	audio_block_t *inputQueueArray[4];
+	AudioEventQueue *event_queue;
 #endif
 };
 
@@ -0,0 +1,181 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_additive.h"
+#include "utility/dspinst.h"
+
+extern "C" {
+extern const int16_t AudioWaveformSine[257];
+}
+
+AudioSynthAdditive::AudioSynthAdditive(void) : AudioStream(0, NULL)
+{
+	freq_setting = 0.0f;
+	gain_current = 0.0f;
+	gain_target = 0.0f;
+	for (int i=0; i < ADDITIVE_MAX_PARTIALS; i++) {
+		phase[i] = 0;
+		increment[i] = 0;
+		rotation_cos[i] = 1.0f;
+		rotation_sin[i] = 0.0f;
+		ratio[i] = i + 1;
+		amp_current[i] = 0.0f;
+		amp_target[i] = 0.0f;
+	}
+}
+
+void AudioSynthAdditive::frequency(float freq)
+{
+	if (freq < 0.0f) {
+		freq = 0.0f;
+	} else if (freq > AUDIO_SAMPLE_RATE_EXACT / 2.0f) {
+		freq = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+	}
+	freq_setting = freq;
+	for (int i=0; i < ADDITIVE_MAX_PARTIALS; i++) {
+		configure(i);
+	}
+}
+
+void AudioSynthAdditive::partialRatio(int n, float r)
+{
+	if (n < 1 || n > ADDITIVE_MAX_PARTIALS) return;
+	if (r < 0.0f) r = 0.0f;
+	ratio[n - 1] = r;
+	configure(n - 1);
+}
+
+void AudioSynthAdditive::restart(void)
+{
+	__disable_irq();
+	for (int i=0; i < ADDITIVE_MAX_PARTIALS; i++) {
+		phase[i] = 0;
+	}
+	__enable_irq();
+}
+
+// The rotation is computed with sinf and cosf here, rather than in update(),
+// because its accuracy sets the tuning within each block.
+void AudioSynthAdditive::configure(int n)
+{
+	float f = freq_setting * ratio[n];
+	uint32_t inc = 0xFFFFFFFF;
+	float c = 1.0f, s = 0.0f;
+
+	if (f < AUDIO_SAMPLE_RATE_EXACT / 2.0f) {
+		inc = f * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+		float w = f * (float)(2.0 * M_PI / AUDIO_SAMPLE_RATE_EXACT);
+		c = cosf(w);
+		s = sinf(w);
+	}
+	__disable_irq();
+	increment[n] = inc;
+	rotation_cos[n] = c;
+	rotation_sin[n] = s;
+	__enable_irq();
+}
+
+// sine of a 32 bit phase, from the 257 point table
+static inline float additive_sine(uint32_t ph)
+{
+	uint32_t index = ph >> 24;
+	int32_t scale = (ph >> 8) & 0xFFFF;
+	int32_t val1 = AudioWaveformSine[index] * (0x10000 - scale);
+	int32_t val2 = AudioWaveformSine[index + 1] * scale;
+	return (float)(val1 + val2) * (float)(1.0 / (32767.0 * 65536.0));
+}
+
+// Four partials at a time, so their recurrences run in parallel rather than
+// each waiting on the multiplies of the sample before.
+static void additive_render4(float *sum, float *s, float *c, const float *rc,
+	const float *rs, float *amp, const float *step)
+{
+	for (uint32_t i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		sum[i] += s[0] * amp[0] + s[1] * amp[1] + s[2] * amp[2] + s[3] * amp[3];
+		for (uint32_t j=0; j < 4; j++) {
+			amp[j] += step[j];
+			float t = c[j] * rc[j] - s[j] * rs[j];
+			s[j] = s[j] * rc[j] + c[j] * rs[j];
+			c[j] = t;
+		}
+	}
+}
+
+void AudioSynthAdditive::update(void)
+{
+	audio_block_t *block;
+	float sum[AUDIO_BLOCK_SAMPLES];
+	float s[4], c[4], rc[4], rs[4], amp[4], step[4];
+	bool silent = true;
+	uint32_t i, n, k = 0;
+
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) sum[i] = 0.0f;
+	for (n=0; n < ADDITIVE_MAX_PARTIALS; n++) {
+		const uint32_t ph = phase[n];
+		const uint32_t inc = increment[n];
+		if (inc >= 0x80000000) {
+			// above Nyquist, would alias
+			amp_current[n] = 0.0f;
+			continue;
+		}
+		phase[n] = ph + inc * AUDIO_BLOCK_SAMPLES;
+		const float target = amp_target[n];
+		if (amp_current[n] == 0.0f && target == 0.0f) continue;
+		amp[k] = amp_current[n];
+		step[k] = (target - amp[k]) * (1.0f / AUDIO_BLOCK_SAMPLES);
+		amp_current[n] = target;
+		rc[k] = rotation_cos[n];
+		rs[k] = rotation_sin[n];
+		s[k] = additive_sine(ph);
+		c[k] = additive_sine(ph + 0x40000000);
+		if (++k == 4) {
+			additive_render4(sum, s, c, rc, rs, amp, step);
+			k = 0;
+		}
+		silent = false;
+	}
+	if (k > 0) {
+		for (; k < 4; k++) {
+			s[k] = c[k] = amp[k] = step[k] = rs[k] = 0.0f;
+			rc[k] = 1.0f;
+		}
+		additive_render4(sum, s, c, rc, rs, amp, step);
+	}
+
+	float gain = gain_current;
+	const float gain_step = (gain_target - gain) * (1.0f / AUDIO_BLOCK_SAMPLES);
+	gain_current = gain_target;
+	if (silent || (gain == 0.0f && gain_step == 0.0f)) return;
+	block = allocate();
+	if (!block) return;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		block->data[i] = saturate16((int32_t)(sum[i] * gain));
+		gain += gain_step;
+	}
+	transmit(block);
+	release(block);
+}
@@ -0,0 +1,98 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_additive_h_
+#define synth_additive_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Additive synthesis, up to 128 sine wave partials in one object.
+//
+// Each partial is a rotating phasor: a complex number multiplied by a fixed
+// rotation every sample, so a sine costs 4 multiplies with no table lookup.
+// The phasor restarts every block from a 32 bit phase accumulator, so
+// rounding never builds up and the partials keep their exact tuning.
+// Amplitude changes ramp across one block.  Partials above half the sample
+// rate, or silent, are skipped.  Uses floating point, intended for Teensy 4.x.
+
+#ifndef ADDITIVE_MAX_PARTIALS
+#define ADDITIVE_MAX_PARTIALS 128
+#endif
+
+class AudioSynthAdditive : public AudioStream
+{
+public:
+	AudioSynthAdditive(void);
+	// fundamental frequency, partials are multiples of this
+	void frequency(float freq);
+	// overall level, 0 to 1.0
+	void amplitude(float n) {
+		if (n < 0.0f) {
+			n = 0.0f;
+		} else if (n > 1.0f) {
+			n = 1.0f;
+		}
+		gain_target = n * 32767.0f;
+	}
+	// level of one partial, 1 to ADDITIVE_MAX_PARTIALS, 0 to 1.0
+	void partial(int n, float level) {
+		if (n < 1 || n > ADDITIVE_MAX_PARTIALS) return;
+		if (level < 0.0f) {
+			level = 0.0f;
+		} else if (level > 1.0f) {
+			level = 1.0f;
+		}
+		amp_target[n - 1] = level;
+	}
+	// levels of partials 1 to count
+	void partials(const float *levels, int count) {
+		if (count > ADDITIVE_MAX_PARTIALS) count = ADDITIVE_MAX_PARTIALS;
+		for (int i=0; i < count; i++) partial(i + 1, levels[i]);
+	}
+	// frequency of one partial, as a multiple of the fundamental.  By
+	// default partial n is harmonic n.
+	void partialRatio(int n, float ratio);
+	// restart every partial at phase 0
+	void restart(void);
+	virtual void update(void);
+
+private:
+	void configure(int n);
+	float freq_setting;
+	float gain_current;   // output scaling, ramped to gain_target
+	float gain_target;
+	uint32_t phase[ADDITIVE_MAX_PARTIALS];
+	uint32_t increment[ADDITIVE_MAX_PARTIALS]; // 0x80000000 and up is above Nyquist
+	float rotation_cos[ADDITIVE_MAX_PARTIALS];
+	float rotation_sin[ADDITIVE_MAX_PARTIALS];
+	float ratio[ADDITIVE_MAX_PARTIALS];
+	float amp_current[ADDITIVE_MAX_PARTIALS];
+	float amp_target[ADDITIVE_MAX_PARTIALS];
+};
+
+#endif
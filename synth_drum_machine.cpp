@@ -0,0 +1,391 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "synth_drum_machine.h"
+#include "utility/dspinst.h"
+
+extern "C" {
+extern const int16_t AudioWaveformSine[257];
+}
+
+#define DRUM_SILENT       32768      // envelope below -90 dB ends a part
+#define DRUM_CHOKE_RATIO  289188864  // 60 dB fall in 10 ms, per update
+
+struct drum_preset_t {
+	float freq;
+	float pitch_mod;
+	float tone_level;
+	float tone_ms;
+	float noise_level;
+	float noise_ms;
+	float highpass;
+	float lowpass;
+	uint8_t group;
+};
+
+static const drum_preset_t drum_presets[] = {
+	//  freq   mod   tone  ms     noise ms     highpass lowpass group
+	{    0.0f, 0.0f, 0.0f,  5.0f, 0.0f,    5.0f,    0.0f, 22050.0f, 0 }, // none
+	{   50.0f, 0.5f, 1.0f, 400.0f, 0.15f,  12.0f,  20.0f,  4000.0f, 0 }, // kick
+	{  180.0f, 0.15f, 0.6f, 150.0f, 0.8f, 220.0f, 1200.0f, 10000.0f, 0 }, // snare
+	{  110.0f, 0.15f, 0.9f, 350.0f, 0.1f,  60.0f,  100.0f,  2000.0f, 0 }, // tom
+	{    0.0f, 0.0f, 0.0f,  5.0f, 0.7f,   60.0f, 7000.0f, 22050.0f, 1 }, // closed hat
+	{    0.0f, 0.0f, 0.0f,  5.0f, 0.7f,  500.0f, 7000.0f, 22050.0f, 1 }, // open hat
+	{    0.0f, 0.0f, 0.0f,  5.0f, 0.6f, 1800.0f, 4500.0f, 16000.0f, 0 }, // cymbal
+	{ 1700.0f, 0.0f, 0.5f, 20.0f, 0.5f,   15.0f, 2000.0f,  8000.0f, 0 }, // rim
+};
+
+AudioSynthDrumMachine::AudioSynthDrumMachine(void) : AudioStream(0, NULL)
+{
+	memset(voices, 0, sizeof(voices));
+	for (int i=0; i < DRUM_MACHINE_MAX_VOICES; i++) {
+		voices[i].volume = 1.0f;
+		configure(voices[i], DRUM_NONE);
+	}
+	configure(voices[0], DRUM_KICK);
+	configure(voices[1], DRUM_SNARE);
+	configure(voices[2], DRUM_CLOSED_HAT);
+	configure(voices[3], DRUM_OPEN_HAT);
+	configure(voices[4], DRUM_TOM);
+	configure(voices[5], DRUM_TOM);
+	configure(voices[6], DRUM_TOM);
+	configure(voices[7], DRUM_RIM);
+	frequency(4, 90.0f);
+	frequency(5, 130.0f);
+	frequency(6, 180.0f);
+	seed = 1 + instance_count++;
+	event_queue = NULL;
+}
+
+// per update decay, for a fall of 60 dB in milliseconds
+static int32_t drum_ratio(float milliseconds)
+{
+	if (milliseconds < 5.0f) milliseconds = 5.0f;
+	else if (milliseconds > 5000.0f) milliseconds = 5000.0f;
+	float blocks = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f)
+		/ (float)AUDIO_BLOCK_SAMPLES;
+	return powf(0.001f, 1.0f / blocks) * 2147483647.0f;
+}
+
+// one pole filter coefficient, for a corner frequency
+static int32_t drum_filter(float freq)
+{
+	if (freq <= 0.0f) return 0;
+	if (freq >= AUDIO_SAMPLE_RATE_EXACT / 2.0f) return 0x7FFFFFFF;
+	float a = 1.0f - expf(-2.0f * 3.14159265f * freq / AUDIO_SAMPLE_RATE_EXACT);
+	return a * 2147483647.0f;
+}
+
+void AudioSynthDrumMachine::configure(voice_t &v, int type)
+{
+	const drum_preset_t *p = &drum_presets[type];
+	float sweep = 1.0f + p->pitch_mod * 3.0f;
+	int32_t inc = p->freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+	int32_t tone_ratio = drum_ratio(p->tone_ms);
+	int32_t noise_ratio = drum_ratio(p->noise_ms);
+	int32_t sweep_ratio = drum_ratio(p->tone_ms * 0.125f);
+	int32_t highpass = drum_filter(p->highpass);
+	int32_t lowpass = drum_filter(p->lowpass);
+	__disable_irq();
+	v.base_increment = inc;
+	v.sweep = sweep;
+	v.tone_level = p->tone_level;
+	v.noise_level = p->noise_level;
+	v.tone_ratio = tone_ratio;
+	v.noise_ratio = noise_ratio;
+	v.sweep_ratio = sweep_ratio;
+	v.highpass = highpass;
+	v.lowpass = lowpass;
+	v.group = p->group;
+	v.type = type;
+	__enable_irq();
+}
+
+void AudioSynthDrumMachine::drum(int voice, int type)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (type < DRUM_NONE || type > DRUM_RIM) type = DRUM_NONE;
+	configure(voices[voice], type);
+}
+
+void AudioSynthDrumMachine::frequency(int voice, float freq)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (freq < 0.0f) freq = 0.0f;
+	else if (freq > AUDIO_SAMPLE_RATE_EXACT / 2.0f) freq = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+	float inc = freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+	if (inc > 0x7FFE0000) inc = 0x7FFE0000;
+	voices[voice].base_increment = inc;
+}
+
+void AudioSynthDrumMachine::pitchMod(int voice, float depth)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (depth < 0.0f) depth = 0.0f;
+	else if (depth > 1.0f) depth = 1.0f;
+	voices[voice].sweep = 1.0f + depth * 3.0f;
+}
+
+void AudioSynthDrumMachine::tone(int voice, float level, float milliseconds)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (level < 0.0f) level = 0.0f;
+	else if (level > 1.0f) level = 1.0f;
+	// the pitch sweep takes an eighth of the tone's decay
+	int32_t tone_ratio = drum_ratio(milliseconds);
+	int32_t sweep_ratio = drum_ratio(milliseconds * 0.125f);
+	__disable_irq();
+	voices[voice].tone_level = level;
+	voices[voice].tone_ratio = tone_ratio;
+	voices[voice].sweep_ratio = sweep_ratio;
+	__enable_irq();
+}
+
+void AudioSynthDrumMachine::noise(int voice, float level, float milliseconds)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (level < 0.0f) level = 0.0f;
+	else if (level > 1.0f) level = 1.0f;
+	int32_t noise_ratio = drum_ratio(milliseconds);
+	__disable_irq();
+	voices[voice].noise_level = level;
+	voices[voice].noise_ratio = noise_ratio;
+	__enable_irq();
+}
+
+void AudioSynthDrumMachine::noiseFilter(int voice, float highpass, float lowpass)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	int32_t hp = drum_filter(highpass);
+	int32_t lp = drum_filter(lowpass);
+	__disable_irq();
+	voices[voice].highpass = hp;
+	voices[voice].lowpass = lp;
+	__enable_irq();
+}
+
+void AudioSynthDrumMachine::choke(int voice, int group)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (group < 0) group = 0;
+	else if (group > 255) group = 255;
+	voices[voice].group = group;
+}
+
+void AudioSynthDrumMachine::level(int voice, float n)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	if (n < 0.0f) n = 0.0f;
+	else if (n > 1.0f) n = 1.0f;
+	voices[voice].volume = n;
+}
+
+void AudioSynthDrumMachine::noteOn(int voice, float velocity)
+{
+	if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return;
+	__disable_irq();
+	trigger(voice, velocity);
+	__enable_irq();
+}
+
+// Start a hit, from the current sample.
+void AudioSynthDrumMachine::trigger(int n, float velocity)
+{
+	if (n < 0 || n >= DRUM_MACHINE_MAX_VOICES) return;
+	voice_t &v = voices[n];
+	if (v.type == DRUM_NONE) return;
+	if (velocity <= 0.0f) return;
+	if (velocity > 1.0f) velocity = 1.0f;
+	float gain = velocity * v.volume * 1073741824.0f;
+	float inc = v.base_increment * v.sweep;
+	if (inc > 0x7FFE0000) inc = 0x7FFE0000;
+	v.phase = 0;
+	v.increment = inc;
+	v.tone_env = v.tone_level * gain;
+	v.noise_env = v.noise_level * gain;
+	v.choked = false;
+	v.active = true;
+	ramp(v);
+	if (v.group) {
+		for (int i=0; i < DRUM_MACHINE_MAX_VOICES; i++) {
+			voice_t &other = voices[i];
+			if (i != n && other.group == v.group && other.active) {
+				other.choked = true;
+				ramp(other);
+			}
+		}
+	}
+}
+
+// Set each part's change per sample, to reach its next value one update
+// from now.  The exponential decays become straight lines, 128 samples
+// long, which starts at any sample when a hit is mid-block.
+void AudioSynthDrumMachine::ramp(voice_t &v)
+{
+	int32_t tone_ratio = v.choked ? DRUM_CHOKE_RATIO : v.tone_ratio;
+	int32_t noise_ratio = v.choked ? DRUM_CHOKE_RATIO : v.noise_ratio;
+	int32_t next;
+
+	if (v.tone_env < DRUM_SILENT) {
+		v.tone_env = 0;
+		v.tone_delta = 0;
+	} else {
+		next = multiply_32x32_rshift32(v.tone_env, tone_ratio) << 1;
+		v.tone_delta = (next - v.tone_env) >> 7;
+		// the pitch falls toward base_increment
+		int32_t excess = v.increment - v.base_increment;
+		next = multiply_32x32_rshift32(excess, v.sweep_ratio) << 1;
+		v.inc_delta = (next - excess) >> 7;
+	}
+	if (v.noise_env < DRUM_SILENT) {
+		v.noise_env = 0;
+		v.noise_delta = 0;
+	} else {
+		next = multiply_32x32_rshift32(v.noise_env, noise_ratio) << 1;
+		v.noise_delta = (next - v.noise_env) >> 7;
+	}
+	if (v.tone_env == 0 && v.noise_env == 0) v.active = false;
+}
+
+// One voice, samples start to end-1, added to sum.
+void AudioSynthDrumMachine::render(voice_t &v, const int16_t *noise,
+	int32_t *sum, int start, int end)
+{
+	int i;
+
+	if (v.tone_env) {
+		uint32_t phase = v.phase;
+		int32_t inc = v.increment, inc_delta = v.inc_delta;
+		int32_t env = v.tone_env, env_delta = v.tone_delta;
+		for (i=start; i < end; i++) {
+			uint32_t index = phase >> 24;
+			int32_t val1 = AudioWaveformSine[index];
+			int32_t val2 = AudioWaveformSine[index+1];
+			uint32_t scale = (phase >> 8) & 0xFFFF;
+			val2 *= scale;
+			val1 *= 0x10000 - scale;
+			phase += inc;
+			inc += inc_delta;
+			env += env_delta;
+			sum[i] += multiply_32x32_rshift32((val1 + val2) >> 8, env);
+		}
+		v.phase = phase;
+		v.increment = inc;
+		v.tone_env = env;
+	}
+	if (v.noise_env) {
+		int32_t hp = v.highpass, lp = v.lowpass;
+		int32_t low = v.highpass_state, out = v.lowpass_state;
+		int32_t env = v.noise_env, env_delta = v.noise_delta;
+		for (i=start; i < end; i++) {
+			// highpass is the input less its lowpass, then a lowpass
+			int32_t high = noise[i] - low;
+			low += multiply_32x32_rshift32_rounded(high << 1, hp);
+			out += multiply_32x32_rshift32_rounded((high - out) << 1, lp);
+			env += env_delta;
+			sum[i] += multiply_32x32_rshift32(out << 8, env);
+		}
+		v.highpass_state = low;
+		v.lowpass_state = out;
+		v.noise_env = env;
+	}
+}
+
+void AudioSynthDrumMachine::update(void)
+{
+	audio_block_t *block;
+	audio_event_t event;
+	int16_t noise[AUDIO_BLOCK_SAMPLES];
+	int32_t sum[AUDIO_BLOCK_SAMPLES];
+	int i, n, offset, next;
+	bool any = false;
+
+	if (event_queue) {
+		event_queue->beginBlock();
+		next = event_queue->nextOffset();
+	} else {
+		next = AUDIO_BLOCK_SAMPLES;
+	}
+	for (n=0; n < DRUM_MACHINE_MAX_VOICES; n++) {
+		if (voices[n].active) {
+			ramp(voices[n]);
+			if (voices[n].active) any = true;
+		}
+	}
+	if (!any && next == AUDIO_BLOCK_SAMPLES) return;
+	block = allocate();
+	if (!block) {
+		// still start this block's hits, so none are lost
+		while (next < AUDIO_BLOCK_SAMPLES) {
+			while (event_queue->pop(next, event)) {
+				if (event.param == AUDIO_EVENT_NOTE_ON) {
+					trigger(event.index, event.value);
+				}
+			}
+			next = event_queue->nextOffset();
+		}
+		return;
+	}
+
+	// one block of white noise, two samples from each xorshift step,
+	// shared by every voice
+	uint32_t x = seed;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i += 2) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		noise[i] = x;
+		noise[i+1] = x >> 16;
+	}
+	seed = x;
+
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) sum[i] = 0;
+	// compute up to each hit, then start it
+	offset = 0;
+	while (1) {
+		for (n=0; n < DRUM_MACHINE_MAX_VOICES; n++) {
+			if (voices[n].active) render(voices[n], noise, sum, offset, next);
+		}
+		if (next >= AUDIO_BLOCK_SAMPLES) break;
+		while (event_queue->pop(next, event)) {
+			if (event.param == AUDIO_EVENT_NOTE_ON) {
+				trigger(event.index, event.value);
+			}
+		}
+		offset = next;
+		next = event_queue->nextOffset();
+	}
+	// a voice at full level reaches half scale, so two hits can overlap
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		block->data[i] = saturate16(sum[i] >> 7);
+	}
+	transmit(block);
+	release(block);
+}
+
+uint16_t AudioSynthDrumMachine::instance_count = 0;
@@ -0,0 +1,135 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_drum_machine_h_
+#define synth_drum_machine_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include "event_queue.h"
+
+// A drum kit of up to 16 voices in one object.
+//
+// Each voice is a sine with a falling pitch, plus noise through a highpass
+// and a lowpass filter, each part with its own exponential decay.  The
+// presets set these for kick, snare, tom, hi-hat, cymbal and rim shot
+// sounds, and every setting can be changed after.  One block of white noise
+// is made per update and shared by all the voices, and the envelopes and
+// pitch sweeps are computed once per block, with each sample following a
+// straight line between.  Voices which have fallen silent use no CPU time.
+//
+// Hits may be posted to an AudioEventQueue, as AUDIO_EVENT_NOTE_ON with the
+// voice as the index and the velocity as the value, to start on an exact
+// sample.  Voices in the same choke group silence each other, so a closed
+// hi-hat cuts off an open one.
+//
+// By default voice 0 is a kick, 1 snare, 2 closed hi-hat, 3 open hi-hat,
+// 4 to 6 low, mid and high toms, 7 a rim shot, and 8 to 15 are unused.
+
+#define DRUM_MACHINE_MAX_VOICES 16
+
+#define DRUM_NONE        0
+#define DRUM_KICK        1
+#define DRUM_SNARE       2
+#define DRUM_TOM         3
+#define DRUM_CLOSED_HAT  4
+#define DRUM_OPEN_HAT    5
+#define DRUM_CYMBAL      6
+#define DRUM_RIM         7
+
+class AudioSynthDrumMachine : public AudioStream
+{
+public:
+	AudioSynthDrumMachine(void);
+	// load a preset, DRUM_KICK etc, into a voice 0 to 15
+	void drum(int voice, int type);
+	// start a hit, at the next update, velocity 0 to 1.0
+	void noteOn(int voice, float velocity = 1.0f);
+	// the tone's frequency, which is reached at the end of its pitch sweep
+	void frequency(int voice, float freq);
+	// 0 to 1.0, the tone starts up to 4 times higher and falls to frequency
+	void pitchMod(int voice, float depth);
+	// the tone's level, 0 to 1.0, and time to fall by 60 dB, 5 to 5000 ms
+	void tone(int voice, float level, float milliseconds);
+	// the noise's level, 0 to 1.0, and time to fall by 60 dB, 5 to 5000 ms
+	void noise(int voice, float level, float milliseconds);
+	// the noise is highpass then lowpass filtered at these frequencies
+	void noiseFilter(int voice, float highpass, float lowpass);
+	// voices in the same group, 1 to 255, cut each other off.  0 for none.
+	void choke(int voice, int group);
+	// the voice's volume, 0 to 1.0.  At 1.0 a hit reaches about half scale.
+	void level(int voice, float n);
+	bool isActive(int voice) {
+		if (voice < 0 || voice >= DRUM_MACHINE_MAX_VOICES) return false;
+		return voices[voice].active;
+	}
+	// sample accurate AUDIO_EVENT_NOTE_ON, with the voice as the index,
+	// posted to this queue
+	void eventQueue(AudioEventQueue &queue) {
+		event_queue = &queue;
+	}
+	virtual void update(void);
+
+private:
+	struct voice_t {
+		bool     active;
+		bool     choked;
+		uint8_t  type;
+		uint8_t  group;
+		uint32_t phase;
+		int32_t  increment;   // tone phase increment, now
+		int32_t  inc_delta;   // change per sample, to the next update
+		int32_t  tone_env;    // 0x40000000 = full level
+		int32_t  tone_delta;
+		int32_t  noise_env;   // 0x40000000 = full level
+		int32_t  noise_delta;
+		int32_t  highpass_state;
+		int32_t  lowpass_state;
+		// settings
+		int32_t  base_increment;
+		float    sweep;       // starting frequency, multiple of base
+		float    tone_level;
+		float    noise_level;
+		float    volume;
+		int32_t  tone_ratio;  // envelope decay per update, 31 bit fraction
+		int32_t  noise_ratio;
+		int32_t  sweep_ratio;
+		int32_t  highpass;    // filter coefficients, 31 bit fraction
+		int32_t  lowpass;
+	};
+	void trigger(int n, float velocity);
+	void ramp(voice_t &v);
+	void configure(voice_t &v, int type);
+	static void render(voice_t &v, const int16_t *noise, int32_t *sum,
+		int start, int end);
+	voice_t voices[DRUM_MACHINE_MAX_VOICES];
+	uint32_t seed;
+	AudioEventQueue *event_queue;
+	static uint16_t instance_count;
+};
+
+#endif
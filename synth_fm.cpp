@@ -0,0 +1,363 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_fm.h"
+#include "utility/dspinst.h"
+
+extern "C" {
+extern const int16_t AudioWaveformSine[257];
+}
+
+#define FM_STATE_IDLE    0
+#define FM_STATE_ATTACK  1
+#define FM_STATE_DECAY   2
+#define FM_STATE_SUSTAIN 3
+#define FM_STATE_RELEASE 4
+
+// For each algorithm and operator, a bit for each operator modulating it.
+// Modulators are always higher numbered, so operators run from 4 down to 1.
+static const uint8_t fm_modulators[FM_ALGORITHMS][FM_OPERATORS] = {
+	{0x02, 0x04, 0x08, 0},  // 4>3>2>1
+	{0x02, 0x0C, 0,    0},  // (3 + 4)>2>1
+	{0x0A, 0x04, 0,    0},  // 3>2, (2 + 4)>1
+	{0x06, 0,    0x08, 0},  // 4>3, (2 + 3)>1
+	{0x02, 0,    0x08, 0},  // 2>1, 4>3
+	{0x08, 0x08, 0x08, 0},  // 4>1, 4>2, 4>3
+	{0,    0,    0x08, 0},  // 4>3
+	{0,    0,    0,    0}   // none
+};
+static const uint8_t fm_carriers[FM_ALGORITHMS] = {
+	0x01, 0x01, 0x01, 0x01, 0x05, 0x07, 0x07, 0x0F
+};
+
+AudioSynthFM::AudioSynthFM(void) : AudioStream(0, NULL)
+{
+	for (int n=0; n < FM_OPERATORS; n++) {
+		op[n].phase = 0;
+		op[n].increment = 0;
+		op[n].ratio = 1.0f;
+		op[n].level = (n == 0) ? 1.0f : 0.0f;
+		op[n].state = FM_STATE_IDLE;
+		op[n].env = 0.0f;
+		op[n].gain = 0;
+		operatorEnvelope(n + 1, 1.0f, 500.0f, 1.0f, 300.0f);
+	}
+	freq_setting = 0.0f;
+	amp_setting = 1.0f;
+	velocity_setting = 1.0f;
+	feedback_gain = 0;
+	feedback1 = 0;
+	feedback2 = 0;
+	algorithm_num = 0;
+	configureOutput();
+}
+
+void AudioSynthFM::noteOn(float freq, float velocity)
+{
+	if (velocity < 0.0f) {
+		velocity = 0.0f;
+	} else if (velocity > 1.0f) {
+		velocity = 1.0f;
+	}
+	frequency(freq);
+	__disable_irq();
+	bool idle = !isActive();
+	velocity_setting = velocity;
+	configureOutput();
+	for (int n=0; n < FM_OPERATORS; n++) {
+		if (idle) {
+			op[n].phase = 0;
+			op[n].env = 0.0f;
+			op[n].gain = 0;
+		}
+		// a new note while one plays attacks from the present level
+		op[n].state = FM_STATE_ATTACK;
+	}
+	if (idle) {
+		feedback1 = 0;
+		feedback2 = 0;
+	}
+	__enable_irq();
+}
+
+void AudioSynthFM::noteOff(void)
+{
+	__disable_irq();
+	for (int n=0; n < FM_OPERATORS; n++) {
+		if (op[n].state != FM_STATE_IDLE) op[n].state = FM_STATE_RELEASE;
+	}
+	__enable_irq();
+}
+
+void AudioSynthFM::frequency(float freq)
+{
+	uint32_t inc[FM_OPERATORS];
+
+	if (freq < 0.0f) {
+		freq = 0.0f;
+	} else if (freq > AUDIO_SAMPLE_RATE_EXACT / 2.0f) {
+		freq = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+	}
+	for (int n=0; n < FM_OPERATORS; n++) {
+		float f = freq * op[n].ratio;
+		if (f > AUDIO_SAMPLE_RATE_EXACT / 2.0f) f = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+		inc[n] = f * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+		if (inc[n] > 0x7FFE0000u) inc[n] = 0x7FFE0000;
+	}
+	__disable_irq();
+	freq_setting = freq;
+	for (int n=0; n < FM_OPERATORS; n++) {
+		op[n].increment = inc[n];
+	}
+	__enable_irq();
+}
+
+void AudioSynthFM::algorithm(int n)
+{
+	if (n < 1) {
+		n = 1;
+	} else if (n > FM_ALGORITHMS) {
+		n = FM_ALGORITHMS;
+	}
+	__disable_irq();
+	algorithm_num = n - 1;
+	configureOutput();
+	__enable_irq();
+}
+
+// carriers are added, so divide by their number to keep the level the same
+void AudioSynthFM::configureOutput(void)
+{
+	uint32_t carriers = 0;
+	for (int n=0; n < FM_OPERATORS; n++) {
+		if (fm_carriers[algorithm_num] & (1 << n)) carriers++;
+	}
+	output_gain = amp_setting * velocity_setting * 65536.0f / (float)carriers;
+}
+
+void AudioSynthFM::operatorRatio(int n, float ratio)
+{
+	if (n < 1 || n > FM_OPERATORS) return;
+	if (ratio < 0.0f) ratio = 0.0f;
+	op[n - 1].ratio = ratio;
+	frequency(freq_setting);
+}
+
+void AudioSynthFM::operatorLevel(int n, float level)
+{
+	if (n < 1 || n > FM_OPERATORS) return;
+	if (level < 0.0f) {
+		level = 0.0f;
+	} else if (level > 1.0f) {
+		level = 1.0f;
+	}
+	op[n - 1].level = level;
+}
+
+void AudioSynthFM::operatorEnvelope(int n, float attack, float decay,
+	float sustain, float release)
+{
+	if (n < 1 || n > FM_OPERATORS) return;
+	if (sustain < 0.0f) {
+		sustain = 0.0f;
+	} else if (sustain > 1.0f) {
+		sustain = 1.0f;
+	}
+	float a = milliseconds2samples(attack);
+	float d = milliseconds2samples(decay);
+	float r = milliseconds2samples(release);
+	__disable_irq();
+	operator_t &o = op[n - 1];
+	o.attack_step = (a > FM_ENVELOPE_CHUNK) ? FM_ENVELOPE_CHUNK / a : 1.0f;
+	o.decay_ratio = (d > FM_ENVELOPE_CHUNK) ? powf(0.001f, FM_ENVELOPE_CHUNK / d) : 0.0f;
+	o.sustain = sustain;
+	o.release_ratio = (r > FM_ENVELOPE_CHUNK) ? powf(0.001f, FM_ENVELOPE_CHUNK / r) : 0.0f;
+	__enable_irq();
+}
+
+bool AudioSynthFM::isActive(void)
+{
+	for (int n=0; n < FM_OPERATORS; n++) {
+		if ((fm_carriers[algorithm_num] & (1 << n))
+		  && op[n].state != FM_STATE_IDLE) return true;
+	}
+	return false;
+}
+
+// advance an envelope by one chunk
+static float fm_envelope(uint8_t &state, float env, float attack_step,
+	float decay_ratio, float sustain, float release_ratio)
+{
+	switch (state) {
+	case FM_STATE_ATTACK:
+		env += attack_step;
+		if (env >= 1.0f) {
+			env = 1.0f;
+			state = FM_STATE_DECAY;
+		}
+		break;
+	case FM_STATE_DECAY:
+		env = sustain + (env - sustain) * decay_ratio;
+		if (env - sustain < 0.001f) {
+			env = sustain;
+			state = FM_STATE_SUSTAIN;
+		}
+		break;
+	case FM_STATE_SUSTAIN:
+		env = sustain;
+		break;
+	case FM_STATE_RELEASE:
+		env *= release_ratio;
+		if (env < 0.0001f) {
+			env = 0.0f;
+			state = FM_STATE_IDLE;
+		}
+		break;
+	default:
+		env = 0.0f;
+	}
+	return env;
+}
+
+typedef struct {
+	uint32_t phase[FM_OPERATORS];
+	uint32_t increment[FM_OPERATORS];
+	int32_t gain[FM_OPERATORS];      // 16 bit fraction
+	int32_t gain_step[FM_OPERATORS];
+	int32_t feedback1;
+	int32_t feedback2;
+	uint32_t feedback_gain;
+	int32_t output_gain;
+} fm_render_t;
+
+static inline int32_t fm_sine(uint32_t ph)
+{
+	uint32_t index = ph >> 24;
+	int32_t scale = (ph >> 8) & 0xFFFF;
+	int32_t val1 = AudioWaveformSine[index];
+	int32_t val2 = AudioWaveformSine[index + 1];
+	return val1 + (((val2 - val1) * scale) >> 16);
+}
+
+// One chunk of samples.  The algorithm is a template parameter, so the
+// compiler removes every unused modulation path.
+template <int alg>
+static void fm_render(int16_t *out, fm_render_t &r)
+{
+	uint32_t phase[FM_OPERATORS];
+	int32_t gain[FM_OPERATORS];
+	int32_t feedback1 = r.feedback1, feedback2 = r.feedback2;
+
+	for (int n=0; n < FM_OPERATORS; n++) {
+		phase[n] = r.phase[n];
+		gain[n] = r.gain[n];
+	}
+	for (uint32_t i=0; i < FM_ENVELOPE_CHUNK; i++) {
+		int32_t o[FM_OPERATORS];
+		int32_t sum = 0;
+		for (int n = FM_OPERATORS - 1; n >= 0; n--) {
+			uint32_t ph = phase[n];
+			phase[n] = ph + r.increment[n];
+			if (n == FM_OPERATORS - 1) {
+				// feedback from the average of the last two outputs,
+				// which keeps high feedback from oscillating
+				ph += (uint32_t)((feedback1 + feedback2) >> 1) * r.feedback_gain;
+			} else {
+				int32_t mod = 0;
+				for (int k = n + 1; k < FM_OPERATORS; k++) {
+					if (fm_modulators[alg][n] & (1 << k)) mod += o[k];
+				}
+				// full scale is 2 cycles of phase, a modulation index of 4 pi
+				ph += (uint32_t)mod << 18;
+			}
+			o[n] = (fm_sine(ph) * gain[n]) >> 16;
+			gain[n] += r.gain_step[n];
+			if (fm_carriers[alg] & (1 << n)) sum += o[n];
+		}
+		feedback2 = feedback1;
+		feedback1 = o[FM_OPERATORS - 1];
+		*out++ = saturate16((sum * r.output_gain) >> 16);
+	}
+	for (int n=0; n < FM_OPERATORS; n++) {
+		r.phase[n] = phase[n];
+		r.gain[n] = gain[n];
+	}
+	r.feedback1 = feedback1;
+	r.feedback2 = feedback2;
+}
+
+void AudioSynthFM::update(void)
+{
+	audio_block_t *block;
+	fm_render_t r;
+	uint32_t n, chunk;
+
+	if (!isActive()) return;
+	block = allocate();
+	if (!block) return;
+
+	for (n=0; n < FM_OPERATORS; n++) {
+		r.phase[n] = op[n].phase;
+		r.increment[n] = op[n].increment;
+		r.gain[n] = op[n].gain;
+	}
+	r.feedback1 = feedback1;
+	r.feedback2 = feedback2;
+	r.feedback_gain = feedback_gain;
+	r.output_gain = output_gain;
+
+	for (chunk=0; chunk < AUDIO_BLOCK_SAMPLES; chunk += FM_ENVELOPE_CHUNK) {
+		// each operator's gain ramps to its envelope at the chunk's end
+		for (n=0; n < FM_OPERATORS; n++) {
+			operator_t &o = op[n];
+			o.env = fm_envelope(o.state, o.env, o.attack_step,
+				o.decay_ratio, o.sustain, o.release_ratio);
+			int32_t target = o.env * o.level * 65536.0f;
+			r.gain_step[n] = (target - r.gain[n]) / FM_ENVELOPE_CHUNK;
+		}
+		int16_t *out = block->data + chunk;
+		switch (algorithm_num) {
+		case 0: fm_render<0>(out, r); break;
+		case 1: fm_render<1>(out, r); break;
+		case 2: fm_render<2>(out, r); break;
+		case 3: fm_render<3>(out, r); break;
+		case 4: fm_render<4>(out, r); break;
+		case 5: fm_render<5>(out, r); break;
+		case 6: fm_render<6>(out, r); break;
+		default: fm_render<7>(out, r); break;
+		}
+	}
+
+	for (n=0; n < FM_OPERATORS; n++) {
+		op[n].phase = r.phase[n];
+		op[n].gain = r.gain[n];
+	}
+	feedback1 = r.feedback1;
+	feedback2 = r.feedback2;
+	transmit(block);
+	release(block);
+}
@@ -0,0 +1,130 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_fm_h_
+#define synth_fm_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Four operator FM synthesis voice, with the 8 algorithms of Yamaha's four
+// operator synthesizers.  Every operator is a sine wave with its own
+// frequency ratio, level and envelope.  Modulation passes between operators
+// on every sample inside update(), so there's none of the one block delay
+// of connecting AudioSynthWaveformSineModulated objects, and operator 4 can
+// modulate itself (feedback).
+//
+// Algorithms, where "a>b" means operator a modulates operator b, and the
+// carriers are heard:
+//   1: 4>3>2>1              carrier 1
+//   2: (3 + 4)>2>1          carrier 1
+//   3: 3>2, (2 + 4)>1       carrier 1
+//   4: 4>3, (2 + 3)>1       carrier 1
+//   5: 2>1, 4>3             carriers 1, 3
+//   6: 4>1, 4>2, 4>3        carriers 1, 2, 3
+//   7: 4>3                  carriers 1, 2, 3
+//   8: none                 carriers 1, 2, 3, 4
+//
+// Envelopes are computed every 16 samples and ramped between.  For more
+// notes, use several AudioSynthFM objects and a mixer.
+
+#define FM_OPERATORS 4
+#define FM_ALGORITHMS 8
+#define FM_ENVELOPE_CHUNK 16
+
+class AudioSynthFM : public AudioStream
+{
+public:
+	AudioSynthFM(void);
+	void noteOn(float freq, float velocity = 1.0f);
+	void noteOff(void);
+	// change the pitch, including while a note plays
+	void frequency(float freq);
+	void amplitude(float n) {	// 0 to 1.0
+		if (n < 0.0f) {
+			n = 0.0f;
+		} else if (n > 1.0f) {
+			n = 1.0f;
+		}
+		amp_setting = n;
+		configureOutput();
+	}
+	// 1 to 8
+	void algorithm(int n);
+	// operator 4 modulating itself, 0 to 1.0
+	void feedback(float n) {
+		if (n < 0.0f) {
+			n = 0.0f;
+		} else if (n > 1.0f) {
+			n = 1.0f;
+		}
+		feedback_gain = n * 131072.0f;
+	}
+	// operator number is 1 to 4.  Ratio is the operator's frequency as a
+	// multiple of the note's frequency.
+	void operatorRatio(int op, float ratio);
+	// Level 0 to 1.0.  For a modulator, 1.0 is a modulation index of 4 pi.
+	void operatorLevel(int op, float level);
+	// Decay and release are the times to fall by 60 dB.
+	void operatorEnvelope(int op, float attack, float decay, float sustain,
+		float release);
+	bool isActive(void);
+	virtual void update(void);
+
+private:
+	struct operator_t {
+		uint32_t phase;
+		uint32_t increment;
+		float ratio;
+		float level;
+		// envelope
+		uint8_t state;
+		float env;            // 0 to 1.0
+		float attack_step;    // added to env every chunk
+		float decay_ratio;    // (env - sustain) multiplied by this every chunk
+		float sustain;
+		float release_ratio;  // env multiplied by this every chunk
+		int32_t gain;         // env * level, 16 bit fraction, at the current sample
+	};
+	void configureOutput(void);
+	static float milliseconds2samples(float milliseconds) {
+		if (milliseconds < 0.0f) milliseconds = 0.0f;
+		else if (milliseconds > 60000.0f) milliseconds = 60000.0f;
+		return milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+	}
+	operator_t op[FM_OPERATORS];
+	float freq_setting;
+	float amp_setting;
+	float velocity_setting;
+	int32_t output_gain;    // amplitude * velocity / carriers, 16 bit fraction
+	uint32_t feedback_gain; // 131072 is one cycle of phase at full scale
+	int32_t feedback1;      // the last two outputs of operator 4
+	int32_t feedback2;
+	uint8_t algorithm_num;  // 0 to 7
+};
+
+#endif
@@ -0,0 +1,110 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "synth_noise_multi.h"
+
+// Paul Kellet's economy pink filter, coefficients with 30 bit fractions
+#define PINK_A0  1071218531  // 0.99765
+#define PINK_A1  1034013377  // 0.96300
+#define PINK_A2  612032840   // 0.57000
+#define PINK_C0  106349833   // 0.0990460
+#define PINK_C1  318382060   // 0.2965164
+#define PINK_C2  1130318677  // 1.0526913
+#define PINK_C3  198427489   // 0.1848
+#define PINK_GAIN 119         // the same level as AudioSynthNoisePink
+
+AudioSynthNoiseMulti::AudioSynthNoiseMulti(void) : AudioStream(0, NULL)
+{
+	for (int i=0; i < NOISE_MULTI_OUTPUTS; i++) {
+		level[i] = 0;
+		pink_enable[i] = false;
+		pink_state[i][0] = 0;
+		pink_state[i][1] = 0;
+		pink_state[i][2] = 0;
+	}
+	seed(1 + 0x10000 * instance_count++);
+}
+
+// White noise in, pink noise out, scaled by gain.  The filter's states
+// are the input shifted left 6 bits.
+static void pink_filter(int16_t *data, int32_t *state, int32_t gain)
+{
+	int32_t b0 = state[0], b1 = state[1], b2 = state[2];
+
+	for (int i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		int32_t x = data[i] << 6;
+		b0 = (multiply_32x32_rshift32_rounded(b0, PINK_A0)
+			+ multiply_32x32_rshift32_rounded(x, PINK_C0)) << 2;
+		b1 = (multiply_32x32_rshift32_rounded(b1, PINK_A1)
+			+ multiply_32x32_rshift32_rounded(x, PINK_C1)) << 2;
+		b2 = (multiply_32x32_rshift32_rounded(b2, PINK_A2)
+			+ multiply_32x32_rshift32_rounded(x, PINK_C2)) << 2;
+		int32_t pink = b0 + b1 + b2 + (multiply_32x32_rshift32_rounded(x, PINK_C3) << 2);
+		data[i] = saturate16(multiply_32x32_rshift32(pink, gain));
+	}
+	state[0] = b0;
+	state[1] = b1;
+	state[2] = b2;
+}
+
+void AudioSynthNoiseMulti::update(void)
+{
+	audio_block_t *block;
+	uint32_t buf[4][AUDIO_BLOCK_SAMPLES/2];
+
+	for (int group=0; group < NOISE_MULTI_OUTPUTS / 4; group++) {
+		int32_t *lev = level + group * 4;
+		if (!lev[0] && !lev[1] && !lev[2] && !lev[3]) continue;
+		noise[group].fill((int16_t *)buf[0], (int16_t *)buf[1],
+			(int16_t *)buf[2], (int16_t *)buf[3]);
+		for (int i=0; i < 4; i++) {
+			int channel = group * 4 + i;
+			int32_t gain = lev[i];
+			if (gain == 0) continue;
+			block = allocate();
+			if (!block) continue;
+			int16_t *in = (int16_t *)buf[i];
+			if (pink_enable[channel]) {
+				memcpy(block->data, in, sizeof(block->data));
+				pink_filter(block->data, pink_state[channel], gain * PINK_GAIN);
+			} else {
+				uint32_t *out = (uint32_t *)(block->data);
+				for (int j=0; j < AUDIO_BLOCK_SAMPLES/2; j++) {
+					uint32_t pair = buf[i][j];
+					int32_t n1 = signed_multiply_32x16b(gain, pair);
+					int32_t n2 = signed_multiply_32x16t(gain, pair);
+					out[j] = pack_16b_16b(n2, n1);
+				}
+			}
+			transmit(block, channel);
+			release(block);
+		}
+	}
+}
+
+uint16_t AudioSynthNoiseMulti::instance_count = 0;
@@ -0,0 +1,140 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_noise_multi_h_
+#define synth_noise_multi_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include "utility/dspinst.h"
+
+// Four independent white noise streams, a block at a time.
+//
+// Four xorshift32 generators step together, so the processor overlaps their
+// shifts and XORs rather than waiting on one serial state, and each step
+// gives two 16 bit samples.  The seeds are scrambled, so the four streams
+// start at unrelated points in the sequence and are uncorrelated.  Any
+// audio object needing several noise sources may use this.
+
+class AudioNoiseXorshift4
+{
+public:
+	AudioNoiseXorshift4(uint32_t n = 1) { seed(n); }
+	void seed(uint32_t n) {
+		for (int i=0; i < 4; i++) {
+			// a different, nonzero, well mixed state for each stream
+			uint32_t x = n + 0x9E3779B9 * (i + 1);
+			x = (x ^ (x >> 16)) * 0x85EBCA6B;
+			x = (x ^ (x >> 13)) * 0xC2B2AE35;
+			x ^= x >> 16;
+			state[i] = x ? x : 0x6D2B79F5;
+		}
+	}
+	// fill four arrays of length samples, which must be even
+	void fill(int16_t *out0, int16_t *out1, int16_t *out2, int16_t *out3,
+	  uint32_t length = AUDIO_BLOCK_SAMPLES) {
+		uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+		for (uint32_t i=0; i < length; i += 2) {
+			a ^= a << 13;
+			b ^= b << 13;
+			c ^= c << 13;
+			d ^= d << 13;
+			a ^= a >> 17;
+			b ^= b >> 17;
+			c ^= c >> 17;
+			d ^= d >> 17;
+			a ^= a << 5;
+			b ^= b << 5;
+			c ^= c << 5;
+			d ^= d << 5;
+			*(uint32_t *)(out0 + i) = a;
+			*(uint32_t *)(out1 + i) = b;
+			*(uint32_t *)(out2 + i) = c;
+			*(uint32_t *)(out3 + i) = d;
+		}
+		state[0] = a;
+		state[1] = b;
+		state[2] = c;
+		state[3] = d;
+	}
+private:
+	uint32_t state[4];
+};
+
+// Eight uncorrelated noise outputs from one object, each white or pink,
+// with its own level.  Outputs at zero level use no CPU time, and the
+// noise for each group of four outputs is made only when one is in use.
+//
+// Pink noise is white noise through Paul Kellet's three pole filter, which
+// is within 0.5 dB of -3 dB per octave from 60 Hz to 10 kHz.
+
+#define NOISE_MULTI_OUTPUTS 8
+
+class AudioSynthNoiseMulti : public AudioStream
+{
+public:
+	AudioSynthNoiseMulti(void);
+	// set every output's level, 0 to 1.0
+	void amplitude(float n) {
+		for (int i=0; i < NOISE_MULTI_OUTPUTS; i++) amplitude(i, n);
+	}
+	// set one output's level, 0 to 1.0
+	void amplitude(int channel, float n) {
+		if (channel < 0 || channel >= NOISE_MULTI_OUTPUTS) return;
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		level[channel] = (int32_t)(n * 65536.0f);
+	}
+	// make one output pink, or back to white
+	void pink(int channel, bool enable) {
+		if (channel < 0 || channel >= NOISE_MULTI_OUTPUTS) return;
+		__disable_irq();
+		if (enable && !pink_enable[channel]) {
+			pink_state[channel][0] = 0;
+			pink_state[channel][1] = 0;
+			pink_state[channel][2] = 0;
+		}
+		pink_enable[channel] = enable;
+		__enable_irq();
+	}
+	// restart all the streams, for repeatable noise
+	void seed(uint32_t n) {
+		__disable_irq();
+		noise[0].seed(n);
+		noise[1].seed(n + 4 * 0x9E3779B9);
+		__enable_irq();
+	}
+	virtual void update(void);
+private:
+	AudioNoiseXorshift4 noise[NOISE_MULTI_OUTPUTS / 4];
+	int32_t level[NOISE_MULTI_OUTPUTS];   // 0=off, 65536=max
+	int32_t pink_state[NOISE_MULTI_OUTPUTS][3];
+	bool    pink_enable[NOISE_MULTI_OUTPUTS];
+	static uint16_t instance_count;
+};
+
+#endif
@@ -0,0 +1,260 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_string_bank.h"
+#include "utility/dspinst.h"
+
+#define STRING_SILENT   4      // a block with no sample louder ends the note
+#define STRING_DAMPED   0.1f   // decay time after noteOff, in seconds
+
+AudioSynthStringBank::AudioSynthStringBank(void) : AudioStream(0, NULL)
+{
+	num_strings = 0;
+	decay_time = 4.0f;
+	damping_setting = 0.5f;
+	coupling_setting = 0.0f;
+	output_gain = 0x7FFFFFFF;
+	seed = 1;
+	memset(strings, 0, sizeof(strings));
+	memset(bridge, 0, sizeof(bridge));
+}
+
+bool AudioSynthStringBank::begin(int16_t *memory, uint32_t length, int count)
+{
+	__disable_irq();
+	num_strings = 0;
+	__enable_irq();
+	if (!memory) return false;
+	if (count < 1) count = 1;
+	else if (count > STRING_BANK_MAX_STRINGS) count = STRING_BANK_MAX_STRINGS;
+	uint32_t size = length / count;
+	if (size > 65535) size = 65535;
+	if (size < 8) return false;
+	memset(memory, 0, length * sizeof(int16_t));
+	__disable_irq();
+	memset(strings, 0, sizeof(strings));
+	memset(bridge, 0, sizeof(bridge));
+	for (int i=0; i < count; i++) {
+		strings[i].buffer = memory + i * size;
+		strings[i].size = size;
+	}
+	num_strings = count;
+	__enable_irq();
+	return true;
+}
+
+// Set the loop's delay, filter and gain from the string's frequency.  The
+// loop delays by the integer length, plus the averaging filter's weight,
+// plus the allpass, which is kept between 0.2 and 1.2 samples where its
+// delay is nearly the same at all low frequencies.  The gain makes up for
+// the averaging filter's loss at the fundamental, so damping changes the
+// tone but not the decay time.  Each string takes from the bridge in
+// proportion to its own loss per trip, which keeps the sum of the strings'
+// resonances, fed back through the bridge, below unity gain.
+void AudioSynthStringBank::configure(int n)
+{
+	string_t &s = strings[n];
+	float f = s.frequency;
+	if (f <= 0.0f) return;
+	float weight = damping_setting * 0.5f;
+	float period = AUDIO_SAMPLE_RATE_EXACT / f;
+	float len = floorf(period - weight - 0.2f);
+	if (len < 2.0f) len = 2.0f;
+	else if (len > (float)s.size) len = s.size;
+	float frac = period - weight - len;
+	if (frac < 0.2f) frac = 0.2f;
+	else if (frac > 1.2f) frac = 1.2f;
+	float coef = (1.0f - frac) / (1.0f + frac);
+	// gain per trip around the loop, falling 60 dB in the decay time
+	float seconds = s.damped ? STRING_DAMPED : decay_time;
+	float gain = powf(0.001f, 1.0f / (seconds * f));
+	float w = 2.0f * 3.14159265f * f / AUDIO_SAMPLE_RATE_EXACT;
+	float h = sqrtf(1.0f - 2.0f * weight * (1.0f - weight) * (1.0f - cosf(w)));
+	gain /= h;
+	if (gain > 0.99998f) gain = 0.99998f;
+	float couple = coupling_setting * 0.5f / num_strings * (1.0f - gain);
+	__disable_irq();
+	s.length = len;
+	s.filter = weight * 32768.0f;
+	s.ap_coef = coef * 32767.0f;
+	s.gain = gain * 65536.0f;
+	s.couple = couple * 4294967296.0f;
+	__enable_irq();
+}
+
+void AudioSynthStringBank::tune(int string, float frequency)
+{
+	if (string < 0 || string >= num_strings) return;
+	if (frequency < 1.0f) frequency = 1.0f;
+	else if (frequency > AUDIO_SAMPLE_RATE_EXACT / 4.0f) frequency = AUDIO_SAMPLE_RATE_EXACT / 4.0f;
+	strings[string].frequency = frequency;
+	configure(string);
+}
+
+void AudioSynthStringBank::noteOn(int string, float frequency, float velocity)
+{
+	if (string < 0 || string >= num_strings) return;
+	if (velocity <= 0.0f) {
+		noteOff(string);
+		return;
+	}
+	if (velocity > 1.0f) velocity = 1.0f;
+	strings[string].damped = false;
+	tune(string, frequency);
+	__disable_irq();
+	strings[string].velocity = velocity * 65535.0f;
+	strings[string].age = 0;
+	strings[string].state = 1;
+	__enable_irq();
+}
+
+int AudioSynthStringBank::noteOn(float frequency, float velocity)
+{
+	int best = 0;
+	for (int i=1; i < num_strings; i++) {
+		// prefer idle strings, then the one plucked longest ago
+		bool idle = strings[i].state == 0, best_idle = strings[best].state == 0;
+		if (idle != best_idle) {
+			if (idle) best = i;
+		} else if (strings[i].age > strings[best].age) {
+			best = i;
+		}
+	}
+	noteOn(best, frequency, velocity);
+	return best;
+}
+
+void AudioSynthStringBank::noteOff(int string)
+{
+	if (string < 0 || string >= num_strings) return;
+	strings[string].damped = true;
+	configure(string);
+}
+
+// One string, for one block, added to sum.  Returns the peak level.
+template <bool coupled>
+static int32_t string_render(int16_t *buffer, uint32_t length, uint32_t &index,
+	int16_t &prior, int16_t &ap_in, int16_t &ap_out, int32_t ap_coef,
+	int32_t filter, int32_t gain, int32_t couple, int32_t *sum,
+	const int32_t *bridge)
+{
+	uint32_t idx = index;
+	int32_t p = prior, x1 = ap_in, y1 = ap_out;
+	int32_t peak = 0;
+
+	for (uint32_t i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		int32_t x = buffer[idx];
+		// averaging filter and loop gain, rounded, because the loop
+		// gain near 1.0 would build a truncation bias into large DC
+		int32_t y = x + (((p - x) * filter + 0x4000) >> 15);
+		p = x;
+		y = (y * gain + 0x8000) >> 16;
+		// allpass, for the fraction of a sample
+		int32_t a = saturate16((((y - y1) * ap_coef + 0x4000) >> 15) + x1);
+		x1 = y;
+		y1 = a;
+		if (coupled) {
+			a = saturate16(a + multiply_32x32_rshift32_rounded(bridge[i], couple));
+		}
+		buffer[idx] = a;
+		sum[i] += a;
+		if (a > peak) peak = a;
+		else if (-a > peak) peak = -a;
+		if (++idx >= length) idx = 0;
+	}
+	index = idx;
+	prior = p;
+	ap_in = x1;
+	ap_out = y1;
+	return peak;
+}
+
+void AudioSynthStringBank::update(void)
+{
+	audio_block_t *block;
+	int32_t sum[AUDIO_BLOCK_SAMPLES];
+	const bool coupled = coupling_setting > 0.0f;
+	bool any = false;
+	uint32_t i, n;
+
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) sum[i] = 0;
+	for (n=0; n < num_strings; n++) {
+		string_t &s = strings[n];
+		s.age++;
+		if (s.length == 0) continue; // never tuned
+		if (s.state == 1) {
+			// pluck: fill the loop with noise, darker for softer notes,
+			// less its average, which would otherwise linger as DC
+			uint32_t lo = seed;
+			int32_t noise = 0, total = 0;
+			int32_t bright = 8192 + ((s.velocity * 24575u) >> 16);
+			for (i=0; i < s.length; i++) {
+				lo = lo * 1664525 + 1013904223;
+				noise += ((((int32_t)lo >> 16) - noise) * bright) >> 15;
+				s.buffer[i] = (noise * (s.velocity >> 1)) >> 16;
+				total += s.buffer[i];
+			}
+			int32_t mean = total / (int32_t)s.length;
+			for (i=0; i < s.length; i++) {
+				s.buffer[i] = saturate16((s.buffer[i] - mean) * 2);
+			}
+			seed = lo;
+			s.index = 0;
+			s.prior = 0;
+			s.ap_in = 0;
+			s.ap_out = 0;
+			s.state = 2;
+		} else if (s.state == 0 && !coupled) {
+			continue;
+		}
+		uint32_t index = s.index;
+		if (index >= s.length) index = 0;
+		int32_t peak;
+		if (coupled) {
+			peak = string_render<true>(s.buffer, s.length, index, s.prior,
+				s.ap_in, s.ap_out, s.ap_coef, s.filter, s.gain, s.couple,
+				sum, bridge);
+		} else {
+			peak = string_render<false>(s.buffer, s.length, index, s.prior,
+				s.ap_in, s.ap_out, s.ap_coef, s.filter, s.gain, 0,
+				sum, NULL);
+		}
+		s.index = index;
+		if (peak < STRING_SILENT) s.state = 0;
+		any = true;
+	}
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) bridge[i] = sum[i];
+	if (!any) return;
+
+	block = allocate();
+	if (!block) return;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		block->data[i] = saturate16(multiply_32x32_rshift32(sum[i] << 1, output_gain));
+	}
+	transmit(block);
+	release(block);
+}
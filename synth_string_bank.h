@@ -0,0 +1,129 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_string_bank_h_
+#define synth_string_bank_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+
+// Karplus-Strong plucked strings, up to 16 in one object.
+//
+// The strings' delay lines share one array given to begin(), which may be in
+// DMAMEM or EXTMEM, divided equally.  Each string is tuned by the integer
+// delay plus a first order allpass for the fraction of a sample, so high
+// notes are in tune.  The loop filter is a two point weighted average, from
+// the classic half and half (dark) to nearly none (bright), and the loop
+// gain sets the decay time.  Strings which have fallen silent are skipped.
+//
+// Sympathetic coupling feeds the sum of all the strings' output, the
+// "bridge", back into every string, so undamped strings tuned to related
+// notes ring along.  Each string takes only as much as it loses, so the
+// strings cannot feed each other into oscillation.  The bridge signal is one block late, which makes no
+// audible difference to resonances lasting many periods.  With coupling on,
+// every tuned string runs all the time.
+
+#define STRING_BANK_MAX_STRINGS 16
+
+class AudioSynthStringBank : public AudioStream
+{
+public:
+	AudioSynthStringBank(void);
+	// delay memory, in any RAM including EXTMEM, and 1 to 16 strings.
+	// The lowest note is AUDIO_SAMPLE_RATE_EXACT * strings / length Hz.
+	bool begin(int16_t *memory, uint32_t length, int strings = 6);
+	// pluck a string, 0 to strings-1, at a frequency, velocity 0 to 1.0
+	void noteOn(int string, float frequency, float velocity);
+	// pluck the string which has been idle longest, returning its number
+	int noteOn(float frequency, float velocity);
+	// damp a string, so it stops within about 100 ms
+	void noteOff(int string);
+	// set a string's pitch without plucking it, for sympathetic resonance
+	void tune(int string, float frequency);
+	// time for a note to fall by 60 dB, 0.1 to 30 seconds
+	void decay(float seconds) {
+		if (seconds < 0.1f) seconds = 0.1f;
+		else if (seconds > 30.0f) seconds = 30.0f;
+		decay_time = seconds;
+		for (int i=0; i < num_strings; i++) configure(i);
+	}
+	// 0 for bright, metallic strings, to 1.0 for dark, soft strings
+	void damping(float n) {
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		damping_setting = n;
+		for (int i=0; i < num_strings; i++) configure(i);
+	}
+	// 0 to 1.0, how strongly the strings excite each other
+	void coupling(float n) {
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		coupling_setting = n;
+		for (int i=0; i < num_strings; i++) configure(i);
+	}
+	void amplitude(float n) {	// 0 to 1.0
+		if (n < 0.0f) n = 0.0f;
+		else if (n > 1.0f) n = 1.0f;
+		output_gain = n * 2147483647.0f;
+	}
+	bool isActive(int string) {
+		if (string < 0 || string >= num_strings) return false;
+		return strings[string].state != 0;
+	}
+	virtual void update(void);
+
+private:
+	struct string_t {
+		int16_t *buffer;
+		uint16_t size;      // this string's share of the memory
+		uint16_t length;    // integer part of the loop delay
+		uint16_t index;
+		uint8_t  state;     // 0=idle, 1=pluck on next update, 2=playing
+		bool     damped;    // noteOff
+		int16_t  prior;     // last sample, for the averaging filter
+		int16_t  ap_in;     // allpass state
+		int16_t  ap_out;
+		int16_t  ap_coef;   // allpass coefficient, 15 bit fraction
+		int16_t  filter;    // averaging filter weight, 15 bit fraction
+		uint16_t gain;      // loop gain, 16 bit fraction
+		int32_t  couple;    // bridge to string gain, 32 bit fraction
+		uint16_t velocity;  // pluck level, 16 bit fraction
+		uint32_t age;       // updates since last plucked
+		float    frequency;
+	};
+	void configure(int n);
+	string_t strings[STRING_BANK_MAX_STRINGS];
+	int32_t  bridge[AUDIO_BLOCK_SAMPLES]; // sum of all strings, last update
+	uint8_t  num_strings;
+	float    decay_time;
+	float    damping_setting;
+	float    coupling_setting;
+	int32_t  output_gain;    // 31 bit fraction
+	uint32_t seed;
+};
+
+#endif
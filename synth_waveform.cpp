@@ -39,27 +39,91 @@
 void AudioSynthWaveform::update(void)
 {
 	audio_block_t *block;
-	int16_t *bp, *end;
+	audio_event_t event;
+	int offset, next;
+
+	if (event_queue) {
+		event_queue->beginBlock();
+		next = event_queue->nextOffset();
+	} else {
+		next = AUDIO_BLOCK_SAMPLES;
+	}
+	if (magnitude == 0 && next == AUDIO_BLOCK_SAMPLES) {
+		phase_accumulator += phase_increment * AUDIO_BLOCK_SAMPLES;
+		return;
+	}
+	// no events can give an arbitrary waveform its data, so without
+	// data nothing is transmitted, even when the block has events
+	block = NULL;
+	if (tone_type != WAVEFORM_ARBITRARY || arbdata) block = allocate();
+	if (!block) {
+		// still apply this block's events, so none are late
+		offset = 0;
+		while (next < AUDIO_BLOCK_SAMPLES) {
+			phase_accumulator += phase_increment * (next - offset);
+			while (event_queue->pop(next, event)) applyEvent(event);
+			offset = next;
+			next = event_queue->nextOffset();
+		}
+		phase_accumulator += phase_increment * (AUDIO_BLOCK_SAMPLES - offset);
+		return;
+	}
+	// compute up to each event, then apply it
+	offset = 0;
+	while (1) {
+		render(block->data, offset, next);
+		if (next >= AUDIO_BLOCK_SAMPLES) break;
+		while (event_queue->pop(next, event)) applyEvent(event);
+		offset = next;
+		next = event_queue->nextOffset();
+	}
+	transmit(block, 0);
+	release(block);
+}
+
+void AudioSynthWaveform::applyEvent(const audio_event_t &event)
+{
+	switch (event.param) {
+	case AUDIO_EVENT_FREQUENCY:
+		frequency(event.value);
+		break;
+	case AUDIO_EVENT_AMPLITUDE:
+		amplitude(event.value);
+		break;
+	case AUDIO_EVENT_OFFSET:
+		offset(event.value);
+		break;
+	case AUDIO_EVENT_PHASE:
+		phase(event.value);
+		break;
+	case AUDIO_EVENT_PULSE_WIDTH:
+		pulseWidth(event.value);
+		break;
+	}
+}
+
+// compute samples start to end-1 of the block
+void AudioSynthWaveform::render(int16_t *data, int start, int end)
+{
+	int16_t *bp;
 	int32_t val1, val2;
 	int16_t magnitude15;
-	uint32_t i, ph, index, index2, scale;
+	uint32_t ph, index, index2, scale;
+	int i;
 	const uint32_t inc = phase_increment;
 
-	ph = phase_accumulator + phase_offset;
+	if (start >= end) return;
+	bp = data + start;
 	if (magnitude == 0) {
-		phase_accumulator += inc * AUDIO_BLOCK_SAMPLES;
+		memset(bp, 0, (end - start) * sizeof(int16_t));
+		phase_accumulator += inc * (end - start);
 		return;
 	}
-	block = allocate();
-	if (!block) {
-		phase_accumulator += inc * AUDIO_BLOCK_SAMPLES;
-		return;
-	}
-	bp = block->data;
+	ph = phase_accumulator + phase_offset;
 
 	switch(tone_type) {
 	case WAVEFORM_SINE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			index = ph >> 24;
 			val1 = AudioWaveformSine[index];
 			val2 = AudioWaveformSine[index+1];
@@ -73,12 +137,12 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_ARBITRARY:
 		if (!arbdata) {
-			release(block);
-			phase_accumulator += inc * AUDIO_BLOCK_SAMPLES;
-			return;
+			memset(bp, 0, (end - start) * sizeof(int16_t));
+			ph += inc * (end - start);
+			break;
 		}
 		// len = 256
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			index = ph >> 24;
 			index2 = index + 1;
 			if (index2 >= 256) index2 = 0;
@@ -94,7 +158,7 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_SQUARE:
 		magnitude15 = signed_saturate_rshift(magnitude, 16, 1);
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			if (ph & 0x80000000) {
 				*bp++ = -magnitude15;
 			} else {
@@ -105,7 +169,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_BANDLIMIT_SQUARE:
-		for (int i = 0 ; i < AUDIO_BLOCK_SAMPLES ; i++)
+		for (i=start; i < end; i++)
 		{
 		  uint32_t new_ph = ph + inc ;
 		  int16_t val = band_limit_waveform.generate_square (new_ph, i) ;
@@ -115,14 +179,14 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_SAWTOOTH:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			*bp++ = signed_multiply_32x16t(magnitude, ph);
 			ph += inc;
 		}
 		break;
 
 	case WAVEFORM_SAWTOOTH_REVERSE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			*bp++ = signed_multiply_32x16t(0xFFFFFFFFu - magnitude, ph);
 			ph += inc;
 		}
@@ -130,7 +194,7 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_BANDLIMIT_SAWTOOTH:
 	case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE:
-		for (i = 0 ; i < AUDIO_BLOCK_SAMPLES; i++)
+		for (i=start; i < end; i++)
 		{
 		  uint32_t new_ph = ph + inc ;
 		  int16_t val = band_limit_waveform.generate_sawtooth (new_ph, i) ;
@@ -143,7 +207,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_TRIANGLE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			uint32_t phtop = ph >> 30;
 			if (phtop == 1 || phtop == 2) {
 				*bp++ = ((0xFFFF - (ph >> 15)) * magnitude) >> 16;
@@ -158,7 +222,7 @@ void AudioSynthWaveform::update(void)
 		do {
 		uint32_t rise = 0xFFFFFFFF / (pulse_width >> 16);
 		uint32_t fall = 0xFFFFFFFF / (0xFFFF - (pulse_width >> 16));
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			if (ph < pulse_width/2) {
 				uint32_t n = (ph >> 16) * rise;
 				*bp++ = ((n >> 16) * magnitude) >> 16;
@@ -176,7 +240,7 @@ void AudioSynthWaveform::update(void)
 
 	case WAVEFORM_PULSE:
 		magnitude15 = signed_saturate_rshift(magnitude, 16, 1);
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			if (ph < pulse_width) {
 				*bp++ = magnitude15;
 			} else {
@@ -187,7 +251,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_BANDLIMIT_PULSE:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++)
+		for (i=start; i < end; i++)
 		{
 		  int32_t new_ph = ph + inc ;
 		  int32_t val = band_limit_waveform.generate_pulse (new_ph, pulse_width, i) ;
@@ -197,7 +261,7 @@ void AudioSynthWaveform::update(void)
 		break;
 
 	case WAVEFORM_SAMPLE_HOLD:
-		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		for (i=start; i < end; i++) {
 			*bp++ = sample;
 			uint32_t newph = ph + inc;
 			if (newph < ph) {
@@ -210,15 +274,11 @@ void AudioSynthWaveform::update(void)
 	phase_accumulator = ph - phase_offset;
 
 	if (tone_offset) {
-		bp = block->data;
-		end = bp + AUDIO_BLOCK_SAMPLES;
-		do {
+		for (bp = data + start; bp < data + end; bp++) {
 			val1 = *bp;
-			*bp++ = signed_saturate_rshift(val1 + tone_offset, 16, 0);
-		} while (bp < end);
+			*bp = signed_saturate_rshift(val1 + tone_offset, 16, 0);
+		}
 	}
-	transmit(block, 0);
-	release(block);
 }
 
 //--------------------------------------------------------------------------------
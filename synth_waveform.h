@@ -30,6 +30,7 @@
 #include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
 #include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
 #include <arm_math.h>    // github.com/PaulStoffregen/cores/blob/master/teensy4/arm_math.h
+#include "event_queue.h"
 
 // waveforms.c
 extern "C" {
@@ -101,7 +102,7 @@ public:
 		phase_accumulator(0), phase_increment(0), phase_offset(0),
 		magnitude(0), pulse_width(0x40000000),
 		arbdata(NULL), sample(0), tone_type(WAVEFORM_SINE),
-		tone_offset(0) {
+		tone_offset(0), event_queue(NULL) {
 	}
 
 	void frequency(float freq) {
@@ -165,9 +166,16 @@ public:
 	void arbitraryWaveform(const int16_t *data, float maxFreq) {
 		arbdata = data;
 	}
+	// sample accurate AUDIO_EVENT_FREQUENCY, AMPLITUDE, OFFSET, PHASE
+	// and PULSE_WIDTH changes, posted to this queue
+	void eventQueue(AudioEventQueue &queue) {
+		event_queue = &queue;
+	}
 	virtual void update(void);
 
 private:
+	void applyEvent(const audio_event_t &event);
+	void render(int16_t *data, int start, int end);
 	uint32_t phase_accumulator;
 	uint32_t phase_increment;
 	uint32_t phase_offset;
@@ -178,6 +186,7 @@ private:
 	short    tone_type;
 	int16_t  tone_offset;
         BandLimitedWaveform band_limit_waveform ;
+	AudioEventQueue *event_queue;
 };
 
 
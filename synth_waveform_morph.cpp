@@ -0,0 +1,341 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_waveform_morph.h"
+#include "arm_math.h"
+#include "utility/dspinst.h"
+
+// uncomment for more accurate but more computationally expensive frequency modulation
+//#define IMPROVE_EXPONENTIAL_ACCURACY
+#define MIPMAP_MIN_TABLE 256
+#define MIPMAP_MAX_FRAMES 1024
+
+
+uint32_t AudioWaveformMipmap::memoryRequired(uint32_t length, uint32_t count)
+{
+	uint32_t words = 0;
+
+	if (length < 64 || length > WAVEFORM_MIPMAP_MAX_LENGTH) return 0;
+	if (length & (length - 1)) return 0;
+	for (uint32_t harmonics = length / 2; harmonics >= 2; harmonics >>= 1) {
+		uint32_t n = harmonics * 2;
+		if (n < MIPMAP_MIN_TABLE) n = MIPMAP_MIN_TABLE;
+		words += n + 1; // plus a copy of the first sample, for interpolation
+	}
+	return words * count;
+}
+
+bool AudioWaveformMipmap::begin(const int16_t *frame_data, uint32_t length,
+	uint32_t count, int16_t *memory, uint32_t size)
+{
+	if (frame_data == NULL) return false;
+	return build(frame_data, 0, length, count, memory, size);
+}
+
+bool AudioWaveformMipmap::begin(short waveform, int16_t *memory, uint32_t size)
+{
+	switch (waveform) {
+	case WAVEFORM_SINE:
+	case WAVEFORM_SAWTOOTH:
+	case WAVEFORM_SAWTOOTH_REVERSE:
+	case WAVEFORM_SQUARE:
+	case WAVEFORM_TRIANGLE:
+		return build(NULL, waveform, WAVEFORM_MIPMAP_MAX_LENGTH, 1, memory, size);
+	}
+	return false;
+}
+
+// Fourier series of the standard waveforms, with the same phase as
+// AudioSynthWaveform.  Only sine terms, so the real parts are zero.
+static void mipmap_series(float *spectrum, short waveform, uint32_t harmonics)
+{
+	for (uint32_t k=0; k < harmonics; k++) {
+		float amp = 0.0f;
+		switch (waveform) {
+		case WAVEFORM_SINE:
+			if (k == 1) amp = 1.0f;
+			break;
+		case WAVEFORM_SAWTOOTH:
+		case WAVEFORM_SAWTOOTH_REVERSE:
+			if (k > 0) amp = (float)(2.0 / M_PI) / (float)k;
+			if (!(k & 1)) amp = -amp;
+			if (waveform == WAVEFORM_SAWTOOTH_REVERSE) amp = -amp;
+			break;
+		case WAVEFORM_SQUARE:
+			if (k & 1) amp = (float)(4.0 / M_PI) / (float)k;
+			break;
+		case WAVEFORM_TRIANGLE:
+			if (k & 1) amp = (float)(8.0 / (M_PI * M_PI)) / (float)(k * k);
+			if ((k & 3) == 3) amp = -amp;
+			break;
+		}
+		spectrum[k * 2] = 0.0f;
+		spectrum[k * 2 + 1] = amp * -0.5f;
+	}
+}
+
+bool AudioWaveformMipmap::build(const int16_t *frame_data, short waveform,
+	uint32_t length, uint32_t count, int16_t *memory, uint32_t size)
+{
+	// 24 kbytes of stack, only while building, which Teensy 4.x has room for
+	float spectrum[WAVEFORM_MIPMAP_MAX_LENGTH];
+	float work[WAVEFORM_MIPMAP_MAX_LENGTH];
+	float wave[WAVEFORM_MIPMAP_MAX_LENGTH];
+	arm_rfft_fast_instance_f32 fft;
+	uint32_t need, offset, nlevels, harmonics, n, bits;
+	uint32_t frame, level, pass, i;
+	float peak = 0.0f, gain = 1.0f;
+
+	need = memoryRequired(length, count);
+	if (need == 0 || count == 0 || count > MIPMAP_MAX_FRAMES) return false;
+	if (memory == NULL || size < need) return false;
+
+	// oscillators using these tables play silence until they're built
+	__disable_irq();
+	data = NULL;
+	__enable_irq();
+
+	// one table per octave, each with half the harmonics of the last
+	offset = 0;
+	nlevels = 0;
+	for (harmonics = length / 2; harmonics >= 2; harmonics >>= 1) {
+		n = harmonics * 2;
+		if (n < MIPMAP_MIN_TABLE) n = MIPMAP_MIN_TABLE;
+		for (bits=0; (1u << bits) < n; bits++) ;
+		level_offset[nlevels] = offset;
+		level_bits[nlevels] = bits;
+		// highest harmonic, harmonics - 1, must stay below half the sample rate
+		level_limit[nlevels] = 0x80000000u / (harmonics - 1);
+		offset += n + 1;
+		nlevels++;
+	}
+	levels = nlevels;
+	frame_size = offset;
+	frames = count;
+
+	// Pass 0 finds the peak of all tables, pass 1 stores them.  Removing
+	// harmonics can make a waveform overshoot, so if any table would clip,
+	// all are scaled down together, keeping every octave at the same level.
+	for (pass=0; pass < 2; pass++) {
+		if (pass == 1 && peak > 32767.0f) gain = 32767.0f / peak;
+		for (frame=0; frame < count; frame++) {
+			if (frame_data) {
+				const int16_t *in = frame_data + frame * length;
+				for (i=0; i < length; i++) work[i] = in[i];
+				arm_rfft_fast_init_f32(&fft, length);
+				arm_rfft_fast_f32(&fft, work, spectrum, 0);
+				for (i=0; i < length; i++) spectrum[i] *= 1.0f / (float)length;
+			} else {
+				mipmap_series(spectrum, waveform, length / 2);
+				for (i=0; i < length; i++) spectrum[i] *= 32767.0f;
+			}
+			harmonics = length / 2;
+			for (level=0; level < nlevels; level++, harmonics >>= 1) {
+				n = 1 << level_bits[level];
+				// keep DC and harmonics 1 to harmonics-1, with no Nyquist term
+				work[0] = spectrum[0] * (float)n;
+				work[1] = 0.0f;
+				for (i=2; i < harmonics * 2; i++) {
+					work[i] = spectrum[i] * (float)n;
+				}
+				for (; i < n; i++) work[i] = 0.0f;
+				arm_rfft_fast_init_f32(&fft, n);
+				arm_rfft_fast_f32(&fft, work, wave, 1);
+				if (pass == 0) {
+					for (i=0; i < n; i++) {
+						if (wave[i] > peak) peak = wave[i];
+						else if (-wave[i] > peak) peak = -wave[i];
+					}
+				} else {
+					int16_t *table = memory + frame * frame_size + level_offset[level];
+					for (i=0; i < n; i++) {
+						float f = wave[i] * gain;
+						table[i] = (int16_t)(f + ((f >= 0.0f) ? 0.5f : -0.5f));
+					}
+					table[n] = table[0];
+				}
+			}
+		}
+	}
+	__disable_irq();
+	data = memory;
+	__enable_irq();
+	return true;
+}
+
+
+// Linear interpolation in the tables of two adjacent frames, and a crossfade
+// between them.  Returns the sample scaled by 2^15.
+static inline int32_t morph_lookup(const int16_t *frame, uint32_t stride,
+	uint32_t ph, uint32_t bits, int32_t fraction)
+{
+	uint32_t index = ph >> (32 - bits);
+	int32_t scale = (ph << bits) >> 16;
+	const int16_t *a = frame + index;
+	const int16_t *b = a + stride;
+	int32_t val1 = (a[0] * (0x10000 - scale) + a[1] * scale) >> 1;
+	int32_t val2 = (b[0] * (0x10000 - scale) + b[1] * scale) >> 1;
+	return val1 + (multiply_32x32_rshift32(val2 - val1, fraction << 15) << 1);
+}
+
+// When the octave changes, this block fades from the old table to the new.
+template <bool crossfade>
+static void morph_render(int16_t *out, const uint32_t *phasedata,
+	const uint32_t *posdata, const int16_t *table, uint32_t bits,
+	const int16_t *oldtable, uint32_t oldbits, uint32_t frame_size,
+	uint32_t stride, int32_t magnitude)
+{
+	for (uint32_t i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		uint32_t ph = phasedata[i];
+		uint32_t offset = (posdata[i] >> 16) * frame_size;
+		int32_t fraction = posdata[i] & 0xFFFF;
+		int32_t val = morph_lookup(table + offset, stride, ph, bits, fraction);
+		if (crossfade) {
+			int32_t old = morph_lookup(oldtable + offset, stride, ph, oldbits, fraction);
+			val = old + (multiply_32x32_rshift32(val - old, i << 24) << 1);
+		}
+		*out++ = multiply_32x32_rshift32(val, magnitude);
+	}
+}
+
+void AudioSynthWaveformMorph::update(void)
+{
+	audio_block_t *block, *moddata, *morphdata;
+	uint32_t phasedata[AUDIO_BLOCK_SAMPLES];
+	uint32_t posdata[AUDIO_BLOCK_SAMPLES];
+	const AudioWaveformMipmap *t = table;
+	uint32_t i, ph, maxinc, maxpos, target, newlevel, oldlevel;
+	int32_t pos, step;
+	const uint32_t inc = phase_increment;
+
+	moddata = receiveReadOnly(0);
+	morphdata = receiveReadOnly(1);
+	if (t == NULL || t->data == NULL) {
+		if (moddata) release(moddata);
+		if (morphdata) release(morphdata);
+		return;
+	}
+
+	// Pre-compute the phase angle for every output sample of this update,
+	// and the highest frequency, which chooses the octave table
+	ph = phase_accumulator;
+	if (moddata) {
+		int16_t *bp = moddata->data;
+		maxinc = 0;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			int32_t n = (*bp++) * modulation_factor; // n is # of octaves to mod
+			int32_t ipart = n >> 27; // 4 integer bits
+			n &= 0x7FFFFFF;          // 27 fractional bits
+			#ifdef IMPROVE_EXPONENTIAL_ACCURACY
+			// exp2 polynomial suggested by Stefan Stenzel on "music-dsp"
+			// mail list, Wed, 3 Sep 2014 10:08:55 +0200
+			int32_t x = n << 3;
+			n = multiply_accumulate_32x32_rshift32_rounded(536870912, x, 1494202713);
+			int32_t sq = multiply_32x32_rshift32_rounded(x, x);
+			n = multiply_accumulate_32x32_rshift32_rounded(n, sq, 1934101615);
+			n = n + (multiply_32x32_rshift32_rounded(sq,
+				multiply_32x32_rshift32_rounded(x, 1358044250)) << 1);
+			n = n << 1;
+			#else
+			// exp2 algorithm by Laurent de Soras
+			// https://www.musicdsp.org/en/latest/Other/106-fast-exp2-approximation.html
+			n = (n + 134217728) << 3;
+
+			n = multiply_32x32_rshift32_rounded(n, n);
+			n = multiply_32x32_rshift32_rounded(n, 715827883) << 3;
+			n = n + 715827882;
+			#endif
+			uint32_t scale = n >> (14 - ipart);
+			uint64_t phstep = (uint64_t)inc * scale;
+			uint32_t step = 0x7FFE0000;
+			if ((uint32_t)(phstep >> 32) < 0x7FFE) step = phstep >> 16;
+			if (step > maxinc) maxinc = step;
+			phasedata[i] = ph;
+			ph += step;
+		}
+		release(moddata);
+	} else {
+		maxinc = inc;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			phasedata[i] = ph;
+			ph += inc;
+		}
+	}
+	phase_accumulator = ph;
+
+	// Position in the frames for every sample, moving to the new morph()
+	// setting over this block.  Never quite reaching the last frame keeps
+	// the second lookup inside the tables.
+	maxpos = (t->frames > 1) ? ((uint32_t)(t->frames - 1) << 16) - 1 : 0;
+	target = morph_target * (t->frames - 1);
+	if (target > maxpos) target = maxpos;
+	pos = morph_current;
+	if ((uint32_t)pos > maxpos) pos = maxpos;
+	step = ((int32_t)target - pos) / AUDIO_BLOCK_SAMPLES;
+	morph_current = target;
+	if (morphdata) {
+		int32_t scale = (t->frames - 1) * 2;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			int32_t p = pos + morphdata->data[i] * scale;
+			if (p < 0) p = 0;
+			else if ((uint32_t)p > maxpos) p = maxpos;
+			posdata[i] = p;
+			pos += step;
+		}
+		release(morphdata);
+	} else {
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			posdata[i] = pos;
+			pos += step;
+		}
+	}
+
+	newlevel = t->levelFor(maxinc);
+	oldlevel = level;
+	level = newlevel;
+	if (oldlevel >= t->levels) oldlevel = newlevel;
+
+	// If the amplitude is zero, no output, but phase still increments properly
+	if (magnitude == 0) return;
+	block = allocate();
+	if (!block) return;
+
+	const int16_t *tab = t->data + t->level_offset[newlevel];
+	const uint32_t stride = (t->frames > 1) ? t->frame_size : 0;
+	if (newlevel == oldlevel) {
+		morph_render<false>(block->data, phasedata, posdata,
+			tab, t->level_bits[newlevel], NULL, 0,
+			t->frame_size, stride, magnitude);
+	} else {
+		morph_render<true>(block->data, phasedata, posdata,
+			tab, t->level_bits[newlevel],
+			t->data + t->level_offset[oldlevel], t->level_bits[oldlevel],
+			t->frame_size, stride, magnitude);
+	}
+	transmit(block);
+	release(block);
+}
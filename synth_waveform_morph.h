@@ -0,0 +1,170 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_waveform_morph_h_
+#define synth_waveform_morph_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include <arm_math.h>    // github.com/PaulStoffregen/cores/blob/master/teensy4/arm_math.h
+#include "synth_waveform.h"
+
+// Band limited single cycle waveforms, for AudioSynthWaveformMorph and
+// AudioSynthWaveformUnison.
+//
+// Each frame (one single cycle waveform) is stored as a set of tables, one
+// per octave, where each table has half the harmonics of the one before.
+// The oscillator plays the table with the most harmonics which stays below
+// half the sample rate, so high notes do not alias.  The tables are built
+// once, by begin(), using an FFT.  Frames may be 64 to 2048 samples long,
+// and must all be the same power of 2 length.  Tables shorter than 256
+// samples are stored as 256, so the highest notes still interpolate well.
+//
+// A 2048 sample frame uses 5386 words of memory, a 256 sample frame 1799.
+// begin() uses floating point and about 24 kbytes of stack while it builds
+// the tables, so AudioWaveformMipmap is intended for Teensy 4.x.
+
+#define WAVEFORM_MIPMAP_MAX_LENGTH 2048
+#define WAVEFORM_MIPMAP_MAX_LEVELS 10
+
+class AudioWaveformMipmap
+{
+public:
+	AudioWaveformMipmap(void) : data(NULL), frames(0), levels(0), frame_size(0) { }
+	// memory needed, in int16_t words, for count frames of length samples
+	static uint32_t memoryRequired(uint32_t length, uint32_t count = 1);
+	// build from count frames, stored one after the other
+	bool begin(const int16_t *frame_data, uint32_t length, uint32_t count,
+		int16_t *memory, uint32_t size);
+	// build one frame of WAVEFORM_SINE, WAVEFORM_SAWTOOTH, WAVEFORM_SQUARE,
+	// WAVEFORM_TRIANGLE or WAVEFORM_SAWTOOTH_REVERSE, from 2048 samples
+	bool begin(short waveform, int16_t *memory, uint32_t size);
+	uint32_t frameCount(void) const { return frames; }
+	bool isReady(void) const { return data != NULL; }
+private:
+	bool build(const int16_t *frame_data, short waveform, uint32_t length,
+		uint32_t count, int16_t *memory, uint32_t size);
+	// the table to use for a phase increment, lowest level that doesn't alias
+	uint32_t levelFor(uint32_t inc) const {
+		uint32_t level = 0;
+		while (level < levels - 1u && inc > level_limit[level]) level++;
+		return level;
+	}
+	friend class AudioSynthWaveformMorph;
+	friend class AudioSynthWaveformUnison;
+	int16_t *data;
+	uint16_t frames;
+	uint8_t levels;
+	uint32_t frame_size;  // words per frame, all levels
+	uint32_t level_offset[WAVEFORM_MIPMAP_MAX_LEVELS];
+	uint32_t level_limit[WAVEFORM_MIPMAP_MAX_LEVELS]; // highest phase increment
+	uint8_t level_bits[WAVEFORM_MIPMAP_MAX_LEVELS];   // log2 of table length
+};
+
+// Wavetable oscillator, playing an AudioWaveformMipmap.  morph() moves
+// through the frames, crossfading between adjacent frames, so each output
+// sample costs two table lookups.  Input 0 modulates frequency, like
+// AudioSynthWaveformModulated, and input 1 adds to the morph position, where
+// full scale is the whole range of frames.
+class AudioSynthWaveformMorph : public AudioStream
+{
+public:
+	AudioSynthWaveformMorph(void) : AudioStream(2, inputQueueArray),
+		table(NULL), phase_accumulator(0), phase_increment(0),
+		modulation_factor(32768), magnitude(0), morph_target(0),
+		morph_current(0), level(0) {
+	}
+	void begin(const AudioWaveformMipmap &waveforms) {
+		__disable_irq();
+		table = &waveforms;
+		morph_current = morph_target = 0;
+		level = 0xFF;
+		__enable_irq();
+	}
+	void begin(float t_amp, float t_freq, const AudioWaveformMipmap &waveforms) {
+		amplitude(t_amp);
+		frequency(t_freq);
+		begin(waveforms);
+	}
+	void frequency(float freq) {
+		if (freq < 0.0f) {
+			freq = 0.0;
+		} else if (freq > AUDIO_SAMPLE_RATE_EXACT / 2.0f) {
+			freq = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+		}
+		phase_increment = freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+		if (phase_increment > 0x7FFE0000u) phase_increment = 0x7FFE0000;
+	}
+	void amplitude(float n) {	// 0 to 1.0
+		if (n < 0) {
+			n = 0;
+		} else if (n > 1.0f) {
+			n = 1.0f;
+		}
+		magnitude = n * 131072.0f;
+	}
+	void phase(float angle) {
+		if (angle < 0.0f) {
+			angle = 0.0f;
+		} else if (angle > 360.0f) {
+			angle = angle - 360.0f;
+			if (angle >= 360.0f) return;
+		}
+		phase_accumulator = angle * (float)(4294967296.0 / 360.0);
+	}
+	// 0 plays the first frame, 1.0 the last, changing smoothly over one block
+	void morph(float position) {
+		if (position < 0.0f) {
+			position = 0.0f;
+		} else if (position > 1.0f) {
+			position = 1.0f;
+		}
+		morph_target = position * 65536.0f;
+	}
+	void frequencyModulation(float octaves) {
+		if (octaves > 12.0f) {
+			octaves = 12.0f;
+		} else if (octaves < 0.1f) {
+			octaves = 0.1f;
+		}
+		modulation_factor = octaves * 4096.0f;
+	}
+	virtual void update(void);
+
+private:
+	audio_block_t *inputQueueArray[2];
+	const AudioWaveformMipmap *table;
+	uint32_t phase_accumulator;
+	uint32_t phase_increment;
+	uint32_t modulation_factor;
+	int32_t  magnitude;
+	uint32_t morph_target;   // 0 to 65536
+	uint32_t morph_current;  // frame position, 16 bit fraction
+	uint8_t  level;          // table used for the last block
+};
+
+#endif
@@ -0,0 +1,232 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_waveform_unison.h"
+#include "utility/dspinst.h"
+
+// uncomment for more accurate but more computationally expensive frequency modulation
+//#define IMPROVE_EXPONENTIAL_ACCURACY
+
+uint16_t AudioSynthWaveformUnison::instance_count = 0;
+
+void AudioSynthWaveformUnison::restart(void)
+{
+	uint32_t ph[UNISON_MAX_VOICES];
+	uint32_t n = seed;
+
+	for (int i=0; i < UNISON_MAX_VOICES; i++) {
+		n = n * 1664525 + 1013904223;
+		ph[i] = n;
+	}
+	seed = n;
+	__disable_irq();
+	for (int i=0; i < UNISON_MAX_VOICES; i++) {
+		phase[i] = ph[i];
+	}
+	__enable_irq();
+}
+
+void AudioSynthWaveformUnison::configure(void)
+{
+	uint32_t inc[UNISON_MAX_VOICES];
+	int32_t gl[UNISON_MAX_VOICES], gr[UNISON_MAX_VOICES];
+	const uint32_t n = num_voices;
+	// per voice gain, scaled so each voice adds sample * 256 to the sums.
+	// Voices have random phases, so their power adds, not their amplitude.
+	const float g = amp_setting / sqrtf((float)n) * 33554432.0f;
+
+	for (uint32_t i=0; i < n; i++) {
+		// -1 for the lowest voice, +1 for the highest
+		float offset = (n > 1) ? (float)(i * 2) / (float)(n - 1) - 1.0f : 0.0f;
+		float f = freq_setting * powf(2.0f, offset * detune_setting * (1.0f / 1200.0f));
+		float ph_inc = f * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+		if (ph_inc > (float)0x7FFE0000) ph_inc = (float)0x7FFE0000;
+		inc[i] = ph_inc;
+		// every other voice on the opposite side, so both sides get
+		// high and low voices
+		float pan = offset * spread_setting;
+		if (i & 1) pan = -pan;
+		float angle = (pan + 1.0f) * (float)(M_PI / 4.0);
+		gl[i] = g * cosf(angle);
+		gr[i] = g * sinf(angle);
+	}
+	__disable_irq();
+	for (uint32_t i=0; i < n; i++) {
+		increment[i] = inc[i];
+		gain_left[i] = gl[i];
+		gain_right[i] = gr[i];
+	}
+	active_voices = n;
+	__enable_irq();
+}
+
+// One voice, added to both sums.  With frequency modulation, scaledata is
+// the frequency ratio for each sample, with a 16 bit fraction.  When the
+// octave table changes, the block fades from the old table to the new.
+template <bool modulated, bool crossfade>
+static uint32_t unison_voice(int32_t *left, int32_t *right, uint32_t ph,
+	uint32_t inc, const uint32_t *scaledata, const int16_t *table, uint32_t bits,
+	const int16_t *oldtable, uint32_t oldbits, int32_t gl, int32_t gr)
+{
+	for (uint32_t i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		uint32_t index = ph >> (32 - bits);
+		int32_t scale = (ph << bits) >> 16;
+		const int16_t *p = table + index;
+		int32_t val = (p[0] * (0x10000 - scale) + p[1] * scale) >> 1;
+		if (crossfade) {
+			index = ph >> (32 - oldbits);
+			scale = (ph << oldbits) >> 16;
+			p = oldtable + index;
+			int32_t old = (p[0] * (0x10000 - scale) + p[1] * scale) >> 1;
+			val = old + (multiply_32x32_rshift32(val - old, i << 24) << 1);
+		}
+		left[i] += multiply_32x32_rshift32(val, gl);
+		right[i] += multiply_32x32_rshift32(val, gr);
+		if (modulated) {
+			uint64_t phstep = (uint64_t)inc * scaledata[i];
+			if ((uint32_t)(phstep >> 32) < 0x7FFE) {
+				ph += phstep >> 16;
+			} else {
+				ph += 0x7FFE0000;
+			}
+		} else {
+			ph += inc;
+		}
+	}
+	return ph;
+}
+
+void AudioSynthWaveformUnison::update(void)
+{
+	audio_block_t *left, *right, *moddata;
+	int32_t sum_left[AUDIO_BLOCK_SAMPLES], sum_right[AUDIO_BLOCK_SAMPLES];
+	uint32_t scaledata[AUDIO_BLOCK_SAMPLES];
+	const AudioWaveformMipmap *t = table;
+	uint32_t i, v, maxscale = 0x10000;
+	const uint32_t nvoices = active_voices;
+	bool modulated = false;
+
+	moddata = receiveReadOnly(0);
+	if (t == NULL || t->data == NULL) {
+		if (moddata) release(moddata);
+		return;
+	}
+
+	// frequency ratio for every sample, shared by all voices
+	if (moddata) {
+		int16_t *bp = moddata->data;
+		maxscale = 0;
+		for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+			int32_t n = (*bp++) * modulation_factor; // n is # of octaves to mod
+			int32_t ipart = n >> 27; // 4 integer bits
+			n &= 0x7FFFFFF;          // 27 fractional bits
+			#ifdef IMPROVE_EXPONENTIAL_ACCURACY
+			// exp2 polynomial suggested by Stefan Stenzel on "music-dsp"
+			// mail list, Wed, 3 Sep 2014 10:08:55 +0200
+			int32_t x = n << 3;
+			n = multiply_accumulate_32x32_rshift32_rounded(536870912, x, 1494202713);
+			int32_t sq = multiply_32x32_rshift32_rounded(x, x);
+			n = multiply_accumulate_32x32_rshift32_rounded(n, sq, 1934101615);
+			n = n + (multiply_32x32_rshift32_rounded(sq,
+				multiply_32x32_rshift32_rounded(x, 1358044250)) << 1);
+			n = n << 1;
+			#else
+			// exp2 algorithm by Laurent de Soras
+			// https://www.musicdsp.org/en/latest/Other/106-fast-exp2-approximation.html
+			n = (n + 134217728) << 3;
+
+			n = multiply_32x32_rshift32_rounded(n, n);
+			n = multiply_32x32_rshift32_rounded(n, 715827883) << 3;
+			n = n + 715827882;
+			#endif
+			uint32_t scale = n >> (14 - ipart);
+			scaledata[i] = scale;
+			if (scale > maxscale) maxscale = scale;
+		}
+		release(moddata);
+		modulated = true;
+	}
+
+	// If the amplitude is zero, no output, but phase still increments
+	if (amp_setting == 0.0f) {
+		for (v=0; v < nvoices; v++) {
+			phase[v] += increment[v] * AUDIO_BLOCK_SAMPLES;
+		}
+		return;
+	}
+
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		sum_left[i] = 0;
+		sum_right[i] = 0;
+	}
+	for (v=0; v < nvoices; v++) {
+		const uint32_t inc = increment[v];
+		uint64_t maxinc = ((uint64_t)inc * maxscale) >> 16;
+		if (maxinc > 0x7FFE0000) maxinc = 0x7FFE0000;
+		uint32_t newlevel = t->levelFor(maxinc);
+		uint32_t oldlevel = level[v];
+		if (oldlevel >= t->levels) oldlevel = newlevel;
+		level[v] = newlevel;
+		const int16_t *tab = t->data + t->level_offset[newlevel];
+		const int16_t *oldtab = t->data + t->level_offset[oldlevel];
+		const uint32_t bits = t->level_bits[newlevel];
+		const uint32_t oldbits = t->level_bits[oldlevel];
+		if (newlevel == oldlevel) {
+			if (modulated) {
+				phase[v] = unison_voice<true, false>(sum_left, sum_right, phase[v], inc,
+					scaledata, tab, bits, oldtab, oldbits, gain_left[v], gain_right[v]);
+			} else {
+				phase[v] = unison_voice<false, false>(sum_left, sum_right, phase[v], inc,
+					scaledata, tab, bits, oldtab, oldbits, gain_left[v], gain_right[v]);
+			}
+		} else {
+			if (modulated) {
+				phase[v] = unison_voice<true, true>(sum_left, sum_right, phase[v], inc,
+					scaledata, tab, bits, oldtab, oldbits, gain_left[v], gain_right[v]);
+			} else {
+				phase[v] = unison_voice<false, true>(sum_left, sum_right, phase[v], inc,
+					scaledata, tab, bits, oldtab, oldbits, gain_left[v], gain_right[v]);
+			}
+		}
+	}
+
+	left = allocate();
+	if (!left) return;
+	right = allocate();
+	if (!right) {
+		release(left);
+		return;
+	}
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		left->data[i] = signed_saturate_rshift(sum_left[i], 16, 8);
+		right->data[i] = signed_saturate_rshift(sum_right[i], 16, 8);
+	}
+	transmit(left, 0);
+	release(left);
+	transmit(right, 1);
+	release(right);
+}
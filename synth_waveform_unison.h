@@ -0,0 +1,156 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef synth_waveform_unison_h_
+#define synth_waveform_unison_h_
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include "synth_waveform_morph.h"
+
+// Unison oscillator bank, for "supersaw" sounds.  Up to 16 copies of one
+// band limited waveform, detuned across a range of cents and panned across
+// the stereo field, are added together inside the object, so a stack which
+// would take a dozen AudioSynthWaveformMorph objects and mixers costs one
+// update.  Each voice starts at a random phase, so the result doesn't depend
+// on the detuned voices beginning in step.  Input 0 modulates frequency,
+// like AudioSynthWaveformModulated.
+
+#ifndef UNISON_MAX_VOICES
+#define UNISON_MAX_VOICES 16
+#endif
+
+class AudioSynthWaveformUnison : public AudioStream
+{
+public:
+	AudioSynthWaveformUnison(void) : AudioStream(1, inputQueueArray),
+		table(NULL), freq_setting(0.0f), amp_setting(0.0f),
+		detune_setting(20.0f), spread_setting(0.5f),
+		modulation_factor(32768), num_voices(7) {
+		seed = 1 + instance_count++;
+		for (int i=0; i < UNISON_MAX_VOICES; i++) {
+			level[i] = 0xFF;
+		}
+		restart();
+		configure();
+	}
+	// plays the first frame of the AudioWaveformMipmap
+	void begin(const AudioWaveformMipmap &waveforms) {
+		__disable_irq();
+		table = &waveforms;
+		for (int i=0; i < UNISON_MAX_VOICES; i++) {
+			level[i] = 0xFF;
+		}
+		__enable_irq();
+		restart();
+	}
+	void begin(float t_amp, float t_freq, const AudioWaveformMipmap &waveforms) {
+		amplitude(t_amp);
+		frequency(t_freq);
+		begin(waveforms);
+	}
+	void frequency(float freq) {
+		if (freq < 0.0f) {
+			freq = 0.0;
+		} else if (freq > AUDIO_SAMPLE_RATE_EXACT / 2.0f) {
+			freq = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+		}
+		freq_setting = freq;
+		configure();
+	}
+	void amplitude(float n) {	// 0 to 1.0
+		if (n < 0) {
+			n = 0;
+		} else if (n > 1.0f) {
+			n = 1.0f;
+		}
+		amp_setting = n;
+		configure();
+	}
+	// number of voices, 1 to UNISON_MAX_VOICES
+	void voices(int n) {
+		if (n < 1) {
+			n = 1;
+		} else if (n > UNISON_MAX_VOICES) {
+			n = UNISON_MAX_VOICES;
+		}
+		num_voices = n;
+		configure();
+	}
+	// the outermost voices are this many cents above and below, 0 to 1200
+	void detune(float cents) {
+		if (cents < 0.0f) {
+			cents = 0.0f;
+		} else if (cents > 1200.0f) {
+			cents = 1200.0f;
+		}
+		detune_setting = cents;
+		configure();
+	}
+	// 0 is mono, 1.0 pans the outermost voices fully left and right
+	void spread(float width) {
+		if (width < 0.0f) {
+			width = 0.0f;
+		} else if (width > 1.0f) {
+			width = 1.0f;
+		}
+		spread_setting = width;
+		configure();
+	}
+	void frequencyModulation(float octaves) {
+		if (octaves > 12.0f) {
+			octaves = 12.0f;
+		} else if (octaves < 0.1f) {
+			octaves = 0.1f;
+		}
+		modulation_factor = octaves * 4096.0f;
+	}
+	// give every voice a new random phase, usually at the start of a note
+	void restart(void);
+	virtual void update(void);
+
+private:
+	void configure(void);
+	audio_block_t *inputQueueArray[1];
+	const AudioWaveformMipmap *table;
+	float freq_setting;
+	float amp_setting;
+	float detune_setting;
+	float spread_setting;
+	uint32_t modulation_factor;
+	uint32_t seed;
+	uint8_t num_voices;
+	uint8_t active_voices;
+	uint32_t phase[UNISON_MAX_VOICES];
+	uint32_t increment[UNISON_MAX_VOICES];
+	int32_t  gain_left[UNISON_MAX_VOICES];
+	int32_t  gain_right[UNISON_MAX_VOICES];
+	uint8_t  level[UNISON_MAX_VOICES];  // octave table used for the last block
+	static uint16_t instance_count;
+};
+
+#endif
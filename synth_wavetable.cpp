@@ -26,6 +26,7 @@
 
 #include <Arduino.h>
 #include "synth_wavetable.h"
+#include "synth_wavetable_render.h"
 #include <dspinst.h>
 #include <SerialFlash.h>
 
@@ -142,6 +143,8 @@ void AudioSynthWavetable::setState(int note, int amp, float freq) {
 	tone_amp = amp * (UINT16_MAX / 127);
 	// scale relative to initial attenuation defined by soundfont file
 	tone_amp = current_sample->INITIAL_ATTENUATION_SCALAR * tone_amp >> 16;
+	lfo_incr_offset = 0;
+	lfo_amp = tone_amp;
 	env_state = STATE_DELAY;
 	PRINT_ENV(STATE_DELAY);
 	state_change = true;
@@ -171,14 +174,14 @@ void AudioSynthWavetable::setFrequency(float freq) {
 
 /**
  * @brief Called by the AudioStream library to fill the audio output buffer.
- * The major parts are the interpolation stage, and the volume envelope stage.
- * Further details on implementation included inline.
+ * The major parts are the LFOs, the interpolation stage, and the volume
+ * envelope stage.  Further details on implementation included inline.
  *
  */
 void AudioSynthWavetable::update(void) {
 #if defined(KINETISK) || defined(__IMXRT1062__)
 	// exit if nothing to do
-	if (env_state == STATE_IDLE || 
+	if (env_state == STATE_IDLE ||
 		nullptr == current_sample ||
 	   (current_sample->LOOP == false && tone_phase >= current_sample->MAX_PHASE)) {
 		env_state = STATE_IDLE;
@@ -197,128 +200,38 @@ void AudioSynthWavetable::update(void) {
 	int32_t env_mult = this->env_mult;
 	int32_t env_incr = this->env_incr;
 
-	uint32_t vib_count = this->vib_count;
-	uint32_t vib_phase = this->vib_phase;
-	int32_t vib_pitch_offset_init = this->vib_pitch_offset_init;
-	int32_t vib_pitch_offset_scnd = this->vib_pitch_offset_scnd;
-
-	uint32_t mod_count = this->mod_count;
-	int32_t mod_phase = this->mod_phase;
-	int32_t mod_pitch_offset_init = this->mod_pitch_offset_init;
-	int32_t mod_pitch_offset_scnd = this->mod_pitch_offset_scnd;
-
 	audio_block_t* block;
 	block = allocate();
 	if (block == NULL) return;
 
-	uint32_t* p, *end;
-	uint32_t index, phase_scale;
-	int32_t s1, s2;
-	uint32_t tmp1, tmp2;
-
-	// filling audio_block two samples at a time
-	p = (uint32_t*)block->data;
-	end = p + AUDIO_BLOCK_SAMPLES / 2;
-
-	// Main loop to handle interpolation, vibrato (vibrato LFO and modulation LFO), and tremolo (modulation LFO only)
-	// Virbrato and modulation offsets/multipliers are updated depending on the LFO_SMOOTHNESS, with max smoothness (7) being one
-	// update per loop interation, and minimum smoothness (1) being once per loop. Hence there is a configurable trade-off
-	// between performance and the smoothness of LFO changes to pitch/amplitude as well as the vibrato/modulation delay granularity
-
-	// also note that the vibrato/tremolo for the two LFO are defined in the SoundFont spec to be a cents (vibrato) or centibel (tremolo)
-	// diviation oscillating with a triangle wave at a given frequency; the following implementation gets the critical points of those
-	// oscillations correct, but linearly interpolates the *frequency* and *amplitude* range between those points, which technically results
-	// in a "bowing" of the triangle wave curve relative to what it should be (although this typically isn't audible)
-	while (p < end) {
-		// TODO: more elegant support of non-looping samples
-		if (s->LOOP == false && tone_phase >= s->MAX_PHASE) break;
-
-		// variable to accumulate LFO pitch offsets; stays 0 if still in vibrato/modulation delay
-		int32_t tone_incr_offset = 0; 
-		if (vib_count++ > s->VIBRATO_DELAY) {
-			vib_phase += s->VIBRATO_INCREMENT;
-			// convert uint32_t phase value to int32_t triangle wave value
-			// TRIANGLE_INITIAL_PHASE (0xC0000000) and 0x40000000 -> 0, 0 -> INT32_MAX/2, 0x80000000 -> INT32_MIN/2
-			int32_t vib_scale = vib_phase & 0x80000000 ? 0x40000000 + vib_phase : 0x3FFFFFFF - vib_phase;
-			// select a vibrato pitch offset based on sign of scale; note that the values "init" and "scnd" values
-			// produced by the decoder script will either both be negative, or both be positive; this allows the 
-			// scalar to either start with either a downward (negative offset) or upward (positive) pitch oscillation
-			int32_t vib_pitch_offset = vib_scale >= 0 ? vib_pitch_offset_init : vib_pitch_offset_scnd;
-			// scale the offset and accumulate into offset
-			// note the offset value is already preshifted by << 2 to account for this func shifting >> 32
-			tone_incr_offset = multiply_accumulate_32x32_rshift32_rounded(tone_incr_offset, vib_scale, vib_pitch_offset);
-		}
-
-		// variable to hold an adjusted amplitude attenuation value; stays at tone_amp if modulation in delay
-		int32_t mod_amp = tone_amp;
-		if (mod_count++ > s->MODULATION_DELAY) {
-			// pitch LFO component is same as above, but we'll also use the scale value for tremolo below
-			mod_phase += s->MODULATION_INCREMENT;
-			int32_t mod_scale = mod_phase & 0x80000000 ? 0x40000000 + mod_phase : 0x3FFFFFFF - mod_phase;
-
-			int32_t mod_pitch_offset = mod_scale >= 0 ? mod_pitch_offset_init : mod_pitch_offset_scnd;
-			tone_incr_offset = multiply_accumulate_32x32_rshift32_rounded(tone_incr_offset, mod_scale, mod_pitch_offset);
-
-			// similar to pitch, sign of init and scnd are either both + or - to allow correct triangle direction
-			int32_t mod_amp_offset = (mod_scale >= 0 ? s->MODULATION_AMPLITUDE_INITIAL_GAIN : s->MODULATION_AMPLITUDE_SECOND_GAIN);
-			// here we scale the amp offset which, similar to the pitch offset, is already pre-shifted by << 2
-			mod_scale = multiply_32x32_rshift32(mod_scale, mod_amp_offset);
-			// the resulting scalar is then used to scale mod_map (possibly resulting in a negative) and add that back into mod_amp
-			mod_amp = signed_multiply_accumulate_32x16b(mod_amp, mod_scale, mod_amp);
-		}
-
-		// producing 2 output values per iteration; repeat more depending on the LFO_SMOOTHNESS
-		// this segment linearly interpolates, calculates how far we step through the sample data, and scales amplitude
-		for (int i = LFO_PERIOD / 2; i; --i, ++p) {
-			// INDEX_BITS representing the higher order bits we use to index into the sample data
-			index = tone_phase >> (32 - s->INDEX_BITS);
-			// recast as uint32_t to load in packed variable; initially int16_t* since we may need to read accross a word boundry
-			// note we are assuming a little-endian cpu (i.e. the first sample is loaded into the lower half-word)
-			tmp1 = *((uint32_t*)(s->sample + index));
-			// phase_scale here being the next 16-bits after the first INDEX_BITS, representing the distince between the samples to interpolate at
-			// 0x0000 gives us all of the first sample point, 0xFFFF all of the second, anything inbetween a sliding mix
-			phase_scale = (tone_phase << s->INDEX_BITS) >> 16;
-			// scaling of second sample point
-			s1 = signed_multiply_32x16t(phase_scale, tmp1);
-			// then add in scaling of first point
-			s1 = signed_multiply_accumulate_32x16b(s1, 0xFFFF - phase_scale, tmp1);
-			// apply amplitude scaling
-			s1 = signed_multiply_32x16b(mod_amp, s1);
-
-			// iterate tone_phase, giving us our desired frequency playback, and apply the offset, giving us our pitch LFOs
-			tone_phase += tone_incr + tone_incr_offset;
-			// break if no loop and we've gone past the end of the sample
-			if (s->LOOP == false && tone_phase >= s->MAX_PHASE) break;
-			// move phase back if a looped sample has overstepped its loop
-			tone_phase = s->LOOP && tone_phase >= s->LOOP_PHASE_END ? tone_phase - s->LOOP_PHASE_LENGTH : tone_phase;
-
-			//repeat as above
-			index = tone_phase >> (32 - s->INDEX_BITS);
-			tmp1 = *((uint32_t*)(s->sample + index));
-			phase_scale = (tone_phase << s->INDEX_BITS) >> 16;
-			s2 = signed_multiply_32x16t(phase_scale, tmp1);
-			s2 = signed_multiply_accumulate_32x16b(s2, 0xFFFF - phase_scale, tmp1);
-			s2 = signed_multiply_32x16b(mod_amp, s2);
-
-			tone_phase += tone_incr + tone_incr_offset;
-			if (s->LOOP == false && tone_phase >= s->MAX_PHASE) break;
-			tone_phase = s->LOOP && tone_phase >= s->LOOP_PHASE_END ? tone_phase - s->LOOP_PHASE_LENGTH : tone_phase;
-
-			// pack the two output samples into the audio_block
-			*p = pack_16b_16b(s2, s1);
-		}
-	}
+	// The LFOs are evaluated once per block, at its end, and the pitch and
+	// amplitude ramp linearly from the previous block's values.
+	wavetable_lfo_t lfo;
+	lfo.vib_count = this->vib_count;
+	lfo.vib_phase = this->vib_phase;
+	lfo.vib_pitch_offset_init = vib_pitch_offset_init;
+	lfo.vib_pitch_offset_scnd = vib_pitch_offset_scnd;
+	lfo.mod_count = this->mod_count;
+	lfo.mod_phase = this->mod_phase;
+	lfo.mod_pitch_offset_init = mod_pitch_offset_init;
+	lfo.mod_pitch_offset_scnd = mod_pitch_offset_scnd;
+	int32_t tone_incr_offset, mod_amp;
+	wavetable_lfo(s, lfo, tone_amp, tone_incr_offset, mod_amp);
+
+	wavetable_render_t r;
+	wavetable_render_setup(r, s, tone_phase, tone_incr,
+		this->lfo_incr_offset, tone_incr_offset, this->lfo_amp, mod_amp);
+	wavetable_reader_t sample = { s->sample };
+	int16_t *data = block->data;
+	int n = wavetable_render(interpolation_mode, data, r, sample);
+	tone_phase = r.tone_phase;
 	// fill with 0s if non-looping sample that ended prematurely
-	if (p < end) {
+	if (n < AUDIO_BLOCK_SAMPLES) {
 		env_state = STATE_IDLE;
 		env_count = 0;
-		while (p < end) *p++ = 0;
+		while (n < AUDIO_BLOCK_SAMPLES) data[n++] = 0;
 	}
 
-	// filling audio_block two samples at a time
-	p = (uint32_t *)block->data;
-	end = p + AUDIO_BLOCK_SAMPLES / 2;
-
 	// the following code handles the volume envelope with the following state transitions controlled here:
 	// STATE_DELAY -> STATE_ATTACK -> STATE_HOLD -> STATE_DECAY -> STATE_SUSTAIN or STATE_IDLE
 	// STATE_RELEASE -> STATE_IDLE
@@ -334,7 +247,7 @@ void AudioSynthWavetable::update(void) {
 	// decay - linear ramp down to a given level of attenuation (SUSTAIN_MULT)
 	// sustain - constant attenuation at a given level (SUSTAIN_MULT)
 	// release - linear ramp down from current attenuation level to full attenuation
-	
+
 	// Definitions of the states generally follow the SoundFont spec, with a major exception being that all
 	// volume scaling is linear realtive to amplitude; this is correct with respect to the attack, but not
 	// the correct implementation relative to the decay and release which should be scaling linearly relative
@@ -343,7 +256,10 @@ void AudioSynthWavetable::update(void) {
 
 	// other points of note are that one env_count corresponds to 1 second * ENVELOPE_PERIOD / AUDIO_SAMPLE_RATE_EXACT;
 	// the ENVELOPE_PERIOD is the number of samples processed per iteration of the following loop
-	while (p < end) {
+	// Each state is a linear ramp, so every run of ENVELOPE_PERIODs up to the next
+	// state change is done in a single loop.
+	int periods = AUDIO_BLOCK_SAMPLES / ENVELOPE_PERIOD;
+	while (periods > 0) {
 		// note env_count == 0 is used as a trigger for state transition
 		if (env_count <= 0) switch (env_state) {
 		case STATE_DELAY:
@@ -378,54 +294,55 @@ void AudioSynthWavetable::update(void) {
 			continue;
 		case STATE_RELEASE:
 			env_state = STATE_IDLE;
-			for (; p < end; ++p) *p = 0;
+			for (n = AUDIO_BLOCK_SAMPLES - periods * ENVELOPE_PERIOD; n < AUDIO_BLOCK_SAMPLES; n++) data[n] = 0;
+			periods = 0;
 			PRINT_ENV(STATE_IDLE);
 			continue;
 		default:
-			p = end;
+			periods = 0;
 			PRINT_ENV(DEFAULT);
 			continue;
 		}
 
-		env_mult += env_incr;
-		// env_mult is INT32_MAX at max (i.e. 31-bits), so shift << 1 so result is aligned with high halfword of tmp1/tmp2
-		tmp1 = signed_multiply_32x16b(env_mult, p[0]) << 1;
-		env_mult += env_incr;
-		tmp2 = signed_multiply_32x16t(env_mult, p[0]) << 1;
-		// pack from high halfword of tmp1, tmp2
-		p[0] = pack_16t_16t(tmp2, tmp1);
-		env_mult += env_incr;
-		tmp1 = signed_multiply_32x16b(env_mult, p[1]) << 1;
-		env_mult += env_incr;
-		tmp2 = signed_multiply_32x16t(env_mult, p[1]) << 1;
-		p[1] = pack_16t_16t(tmp2, tmp1);
-		env_mult += env_incr;
-		tmp1 = signed_multiply_32x16b(env_mult, p[2]) << 1;
-		env_mult += env_incr;
-		tmp2 = signed_multiply_32x16t(env_mult, p[2]) << 1;
-		p[2] = pack_16t_16t(tmp2, tmp1);
-		env_mult += env_incr;
-		tmp1 = signed_multiply_32x16b(env_mult, p[3]) << 1;
-		env_mult += env_incr;
-		tmp2 = signed_multiply_32x16t(env_mult, p[3]) << 1;
-		p[3] = pack_16t_16t(tmp2, tmp1);
-
-		p += ENVELOPE_PERIOD / 2;
-		env_count--;
+		int run = env_count < periods ? env_count : periods;
+		uint32_t *p = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES - periods * ENVELOPE_PERIOD);
+		uint32_t *end = p + run * ENVELOPE_PERIOD / 2;
+		uint32_t tmp1, tmp2;
+		if (env_incr == 0) {
+			while (p < end) {
+				// env_mult is INT32_MAX at max (i.e. 31-bits), so shift << 1 so result is aligned with high halfword of tmp1/tmp2
+				tmp1 = signed_multiply_32x16b(env_mult, *p) << 1;
+				tmp2 = signed_multiply_32x16t(env_mult, *p) << 1;
+				// pack from high halfword of tmp1, tmp2
+				*p++ = pack_16t_16t(tmp2, tmp1);
+			}
+		} else {
+			while (p < end) {
+				env_mult += env_incr;
+				tmp1 = signed_multiply_32x16b(env_mult, *p) << 1;
+				env_mult += env_incr;
+				tmp2 = signed_multiply_32x16t(env_mult, *p) << 1;
+				*p++ = pack_16t_16t(tmp2, tmp1);
+			}
+		}
+		periods -= run;
+		env_count -= run;
 	}
 
 	// copy state back, unless there was a state change
 	if (this->state_change == false) {
 		this->tone_phase = tone_phase;
+		this->lfo_incr_offset = tone_incr_offset;
+		this->lfo_amp = mod_amp;
 		this->env_state = env_state;
 		this->env_count = env_count;
 		this->env_mult = env_mult;
 		this->env_incr = env_incr;
 		if (this->env_state != STATE_IDLE) {
-			this->vib_count = vib_count;
-			this->vib_phase = vib_phase;
-			this->mod_count = mod_count;
-			this->mod_phase = mod_phase;
+			this->vib_count = lfo.vib_count;
+			this->vib_phase = lfo.vib_phase;
+			this->mod_count = lfo.mod_count;
+			this->mod_phase = lfo.mod_phase;
 		}
 		else {
 			this->vib_count = this->mod_count = 0;
@@ -35,6 +35,15 @@
 #define WAVETABLE_NOTE_TO_FREQUENCY(N) (440.0 * pow(2.0, ((N) - 69) / 12.0))
 #define WAVETABLE_DECIBEL_SHIFT(dB) (pow(10.0, (dB)/20.0))
 
+#define WAVETABLE_INTERPOLATION_NONE   0
+#define WAVETABLE_INTERPOLATION_LINEAR 1
+#define WAVETABLE_INTERPOLATION_CUBIC  2
+
+// the interpolation used by new objects, until interpolation() is called
+#ifndef WAVETABLE_INTERPOLATION_DEFAULT
+#define WAVETABLE_INTERPOLATION_DEFAULT WAVETABLE_INTERPOLATION_LINEAR
+#endif
+
 class AudioSynthWavetable : public AudioStream
 {
 public:
@@ -123,6 +132,22 @@ public:
 		tone_amp = (uint16_t)(UINT16_MAX*v);
 	}
 
+	/**
+	 * @brief Choose how samples are interpolated, trading CPU time for
+	 * quality.
+	 *
+	 * WAVETABLE_INTERPOLATION_NONE uses the nearest earlier sample, and is
+	 * fastest, but adds aliasing and noise.  WAVETABLE_INTERPOLATION_LINEAR
+	 * (the default) is a good match for most SoundFont samples.
+	 * WAVETABLE_INTERPOLATION_CUBIC (4 point Hermite) is smoothest, for
+	 * samples pitched far from their root note, and uses the most CPU time.
+	 * @param mode one of WAVETABLE_INTERPOLATION_NONE, _LINEAR or _CUBIC
+	 */
+	void interpolation(int mode) {
+		if (mode < WAVETABLE_INTERPOLATION_NONE || mode > WAVETABLE_INTERPOLATION_CUBIC) return;
+		interpolation_mode = mode;
+	}
+
 	/**
 	 * @brief Scale midi_amp to a value between 0.0 and 1.0
 	 * using a logarithmic tranformation.
@@ -173,6 +198,7 @@ public:
 private:
 	void setState(int note, int amp, float freq);
 	volatile bool state_change = false;
+	volatile uint8_t interpolation_mode = WAVETABLE_INTERPOLATION_DEFAULT;
 
 	volatile const instrument_data* instrument = NULL;
 	volatile const sample_data* current_sample = NULL;
@@ -199,5 +225,9 @@ private:
 	volatile uint32_t mod_phase = TRIANGLE_INITIAL_PHASE;
 	volatile int32_t mod_pitch_offset_init = 0;
 	volatile int32_t mod_pitch_offset_scnd = 0;
+
+	//LFO outputs at the end of the previous block, the start of the next ramp
+	volatile int32_t lfo_incr_offset = 0;
+	volatile int32_t lfo_amp = 0;
 };
 
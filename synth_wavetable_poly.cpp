@@ -0,0 +1,342 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <Arduino.h>
+#include "synth_wavetable_poly.h"
+#include "utility/dspinst.h"
+
+#define STATE_IDLE    AudioSynthWavetable::STATE_IDLE
+#define STATE_DELAY   AudioSynthWavetable::STATE_DELAY
+#define STATE_ATTACK  AudioSynthWavetable::STATE_ATTACK
+#define STATE_HOLD    AudioSynthWavetable::STATE_HOLD
+#define STATE_DECAY   AudioSynthWavetable::STATE_DECAY
+#define STATE_SUSTAIN AudioSynthWavetable::STATE_SUSTAIN
+#define STATE_RELEASE AudioSynthWavetable::STATE_RELEASE
+
+static const int32_t UNITY_GAIN = AudioSynthWavetable::UNITY_GAIN;
+static const int ENVELOPE_PERIOD = AudioSynthWavetable::ENVELOPE_PERIOD;
+
+// each voice is added to the sum at 1/256 of its output scale, so 256
+// full scale voices fit in the 32 bit sum
+#define SUM_SHIFT 8
+
+AudioSynthWavetablePoly::AudioSynthWavetablePoly(void) : AudioStream(0, NULL)
+{
+	memset(voice, 0, sizeof(voice));
+	for (int i=0; i < WAVETABLE_POLY_CHANNELS; i++) {
+		chan[i].instrument = NULL;
+		chan[i].volume = 1.0f;
+		chan[i].position = 0.0f;
+		chan[i].bend = 1.0f;
+		updateGains(chan[i]);
+	}
+	note_count = 0;
+	voice_limit = WAVETABLE_POLY_VOICES;
+	interpolation_mode = WAVETABLE_INTERPOLATION_DEFAULT;
+	master_gain = 65536;
+}
+
+void AudioSynthWavetablePoly::setInstrument(int channel, const instrument_data &instrument)
+{
+	if (channel < 1 || channel > WAVETABLE_POLY_CHANNELS) return;
+	__disable_irq();
+	chan[channel - 1].instrument = &instrument;
+	__enable_irq();
+}
+
+// equal power pan, in the scale used by render()
+void AudioSynthWavetablePoly::updateGains(channel_t &ch)
+{
+	float angle = (ch.position + 1.0f) * (float)(M_PI / 4.0);
+	float scale = ch.volume * (float)(1 << (33 - SUM_SHIFT));
+	int32_t left = cosf(angle) * scale;
+	int32_t right = sinf(angle) * scale;
+	__disable_irq();
+	ch.gain_left = left;
+	ch.gain_right = right;
+	__enable_irq();
+}
+
+void AudioSynthWavetablePoly::channelVolume(int channel, float level)
+{
+	if (channel < 1 || channel > WAVETABLE_POLY_CHANNELS) return;
+	if (level < 0.0f) level = 0.0f;
+	else if (level > 1.0f) level = 1.0f;
+	chan[channel - 1].volume = level;
+	updateGains(chan[channel - 1]);
+}
+
+void AudioSynthWavetablePoly::pan(int channel, float position)
+{
+	if (channel < 1 || channel > WAVETABLE_POLY_CHANNELS) return;
+	if (position < -1.0f) position = -1.0f;
+	else if (position > 1.0f) position = 1.0f;
+	chan[channel - 1].position = position;
+	updateGains(chan[channel - 1]);
+}
+
+void AudioSynthWavetablePoly::pitchBend(int channel, float semitones)
+{
+	if (channel < 1 || channel > WAVETABLE_POLY_CHANNELS) return;
+	if (semitones < -24.0f) semitones = -24.0f;
+	else if (semitones > 24.0f) semitones = 24.0f;
+	float ratio = powf(2.0f, semitones * (1.0f / 12.0f));
+	__disable_irq();
+	chan[channel - 1].bend = ratio;
+	__enable_irq();
+}
+
+void AudioSynthWavetablePoly::noteOn(int channel, int note, int velocity)
+{
+	if (velocity <= 0) {
+		noteOff(channel, note);
+		return;
+	}
+	if (channel < 1 || channel > WAVETABLE_POLY_CHANNELS) return;
+	if (note < 0 || note > 127) return;
+	if (velocity > 127) velocity = 127;
+	const int ch = channel - 1;
+	const instrument_data *inst = chan[ch].instrument;
+	if (!inst || inst->sample_count == 0) return;
+
+	// note ranges calculated by sound font decoder
+	int i;
+	for (i=0; i < inst->sample_count - 1 && note > inst->sample_note_ranges[i]; i++) ;
+	const sample_data *s = &inst->samples[i];
+	float incr = AudioSynthWavetable::noteToFreq(note) * s->PER_HERTZ_PHASE_INCREMENT;
+	int32_t amp = velocity * (UINT16_MAX / 127);
+	amp = s->INITIAL_ATTENUATION_SCALAR * amp >> 16;
+
+	__disable_irq();
+	// the same note restarts, then a free voice, then the quietest
+	// releasing voice, and last of all the oldest
+	int n = -1, idle = -1, releasing = -1, oldest = -1;
+	for (i=0; i < voice_limit; i++) {
+		voice_t &v = voice[i];
+		if (v.env_state == STATE_IDLE) {
+			if (idle < 0) idle = i;
+			continue;
+		}
+		if (v.channel == ch && v.note == note) {
+			n = i;
+			break;
+		}
+		if (v.env_state == STATE_RELEASE) {
+			if (releasing < 0 || v.env_mult < voice[releasing].env_mult) releasing = i;
+		}
+		if (oldest < 0 || note_count - v.age > note_count - voice[oldest].age) oldest = i;
+	}
+	if (n < 0) n = idle;
+	if (n < 0) n = releasing;
+	if (n < 0) n = oldest;
+	voice_t &v = voice[n];
+	v.sample = s;
+	v.channel = ch;
+	v.note = note;
+	v.age = note_count++;
+	v.tone_phase = 0;
+	v.tone_incr = incr;
+	v.tone_amp = amp;
+	v.lfo.vib_pitch_offset_init = incr * s->VIBRATO_PITCH_COEFFICIENT_INITIAL;
+	v.lfo.vib_pitch_offset_scnd = incr * s->VIBRATO_PITCH_COEFFICIENT_SECOND;
+	v.lfo.mod_pitch_offset_init = incr * s->MODULATION_PITCH_COEFFICIENT_INITIAL;
+	v.lfo.mod_pitch_offset_scnd = incr * s->MODULATION_PITCH_COEFFICIENT_SECOND;
+	v.lfo.vib_count = v.lfo.mod_count = 0;
+	v.lfo.vib_phase = v.lfo.mod_phase = AudioSynthWavetable::TRIANGLE_INITIAL_PHASE;
+	v.lfo_incr_offset = 0;
+	v.lfo_amp = amp;
+	v.env_mult = v.env_incr = 0;
+	v.env_count = s->DELAY_COUNT;
+	v.env_state = STATE_DELAY;
+	__enable_irq();
+}
+
+void AudioSynthWavetablePoly::noteOff(int channel, int note)
+{
+	if (channel < 1 || channel > WAVETABLE_POLY_CHANNELS) return;
+	__disable_irq();
+	for (int i=0; i < voice_limit; i++) {
+		voice_t &v = voice[i];
+		if (v.channel != channel - 1 || v.note != note) continue;
+		if (v.env_state == STATE_IDLE || v.env_state == STATE_RELEASE) continue;
+		v.env_state = STATE_RELEASE;
+		v.env_count = v.sample->RELEASE_COUNT;
+		if (v.env_count <= 0) v.env_count = 1;
+		v.env_incr = -(v.env_mult) / (v.env_count * ENVELOPE_PERIOD);
+	}
+	__enable_irq();
+}
+
+void AudioSynthWavetablePoly::allNotesOff(void)
+{
+	for (int ch=1; ch <= WAVETABLE_POLY_CHANNELS; ch++) {
+		for (int note=0; note < 128; note++) {
+			noteOff(ch, note);
+		}
+	}
+}
+
+void AudioSynthWavetablePoly::allSoundOff(void)
+{
+	__disable_irq();
+	for (int i=0; i < WAVETABLE_POLY_VOICES; i++) {
+		voice[i].env_state = STATE_IDLE;
+	}
+	__enable_irq();
+}
+
+int AudioSynthWavetablePoly::activeVoices(void)
+{
+	int count = 0;
+	for (int i=0; i < voice_limit; i++) {
+		if (*(volatile uint8_t *)&voice[i].env_state != STATE_IDLE) count++;
+	}
+	return count;
+}
+
+// Add one voice into the stereo sum, with the same sample playback, LFOs
+// and volume envelope as AudioSynthWavetable::update().  Returns false
+// when the voice has finished.
+bool AudioSynthWavetablePoly::render(voice_t &v, int32_t *left, int32_t *right)
+{
+	const sample_data *s = v.sample;
+	const channel_t &ch = chan[v.channel];
+	int16_t data[AUDIO_BLOCK_SAMPLES];
+	const uint32_t tone_incr = (ch.bend == 1.0f) ? v.tone_incr : (uint32_t)(v.tone_incr * ch.bend);
+	bool ended = false;
+
+	// sample playback, at the pitch and amplitude of the LFOs
+	int32_t tone_incr_offset, mod_amp;
+	wavetable_lfo(s, v.lfo, v.tone_amp, tone_incr_offset, mod_amp);
+	wavetable_render_t r;
+	wavetable_render_setup(r, s, v.tone_phase, tone_incr,
+		v.lfo_incr_offset, tone_incr_offset, v.lfo_amp, mod_amp);
+	wavetable_reader_t sample = { s->sample };
+	int n = wavetable_render(interpolation_mode, data, r, sample);
+	if (n < AUDIO_BLOCK_SAMPLES) {
+		// a sample without a loop has ended
+		while (n < AUDIO_BLOCK_SAMPLES) data[n++] = 0;
+		ended = true;
+	}
+	v.tone_phase = r.tone_phase;
+	v.lfo_incr_offset = tone_incr_offset;
+	v.lfo_amp = mod_amp;
+
+	// volume envelope, then added to the sum at the channel's gains
+	const int32_t gain_left = ch.gain_left;
+	const int32_t gain_right = ch.gain_right;
+	uint8_t env_state = v.env_state;
+	int32_t env_count = v.env_count;
+	int32_t env_mult = v.env_mult;
+	int32_t env_incr = v.env_incr;
+	n = 0;
+	while (n < AUDIO_BLOCK_SAMPLES) {
+		if (env_count <= 0) switch (env_state) {
+		case STATE_DELAY:
+			env_state = STATE_ATTACK;
+			env_count = s->ATTACK_COUNT;
+			// a zero length segment ends at once
+			env_incr = env_count > 0 ? UNITY_GAIN / (env_count * ENVELOPE_PERIOD) : 0;
+			continue;
+		case STATE_ATTACK:
+			env_mult = UNITY_GAIN;
+			env_state = STATE_HOLD;
+			env_count = s->HOLD_COUNT;
+			env_incr = 0;
+			continue;
+		case STATE_HOLD:
+			env_state = STATE_DECAY;
+			env_count = s->DECAY_COUNT;
+			env_incr = env_count > 0 ? (-s->SUSTAIN_MULT) / (env_count * ENVELOPE_PERIOD) : 0;
+			continue;
+		case STATE_DECAY:
+			env_mult = UNITY_GAIN - s->SUSTAIN_MULT;
+			env_state = env_mult < UNITY_GAIN / UINT16_MAX ? STATE_RELEASE : STATE_SUSTAIN;
+			env_incr = 0;
+			continue;
+		case STATE_SUSTAIN:
+			env_count = INT32_MAX;
+			continue;
+		default:
+			// release has finished
+			env_state = STATE_IDLE;
+			n = AUDIO_BLOCK_SAMPLES;
+			continue;
+		}
+		for (int i=0; i < ENVELOPE_PERIOD; i++, n++) {
+			env_mult += env_incr;
+			int32_t val = signed_multiply_32x16b(env_mult, data[n]);
+			left[n] += multiply_32x32_rshift32(val, gain_left);
+			right[n] += multiply_32x32_rshift32(val, gain_right);
+		}
+		env_count--;
+	}
+	if (ended) env_state = STATE_IDLE;
+	v.env_state = env_state;
+	v.env_count = env_count;
+	v.env_mult = env_mult;
+	v.env_incr = env_incr;
+	return env_state != STATE_IDLE;
+}
+
+void AudioSynthWavetablePoly::update(void)
+{
+#if defined(KINETISK) || defined(__IMXRT1062__)
+	int32_t left[AUDIO_BLOCK_SAMPLES];
+	int32_t right[AUDIO_BLOCK_SAMPLES];
+	audio_block_t *blockL, *blockR;
+	bool active = false;
+	int i;
+
+	for (i=0; i < voice_limit; i++) {
+		if (voice[i].env_state == STATE_IDLE) continue;
+		if (!active) {
+			memset(left, 0, sizeof(left));
+			memset(right, 0, sizeof(right));
+			active = true;
+		}
+		render(voice[i], left, right);
+	}
+	if (!active) return;
+	blockL = allocate();
+	if (!blockL) return;
+	blockR = allocate();
+	if (!blockR) {
+		release(blockL);
+		return;
+	}
+	const int32_t gain = master_gain << SUM_SHIFT;
+	for (i=0; i < AUDIO_BLOCK_SAMPLES; i++) {
+		blockL->data[i] = saturate16(multiply_32x32_rshift32(left[i], gain));
+		blockR->data[i] = saturate16(multiply_32x32_rshift32(right[i], gain));
+	}
+	transmit(blockL, 0);
+	transmit(blockR, 1);
+	release(blockL);
+	release(blockR);
+#endif
+}
@@ -0,0 +1,134 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include "synth_wavetable.h"
+#include "synth_wavetable_render.h"
+
+// Maximum number of voices.  Each voice uses about 90 bytes.
+#ifndef WAVETABLE_POLY_VOICES
+#define WAVETABLE_POLY_VOICES 64
+#endif
+#define WAVETABLE_POLY_CHANNELS 16
+
+/**
+ * Many AudioSynthWavetable voices in one object, playing the same
+ * instrument_data, with one instrument per MIDI channel.  Voices are
+ * allocated and stolen internally, and every voice is added directly into
+ * one stereo output, so there is no per voice AudioStream, audio block or
+ * mixer.
+ */
+class AudioSynthWavetablePoly : public AudioStream
+{
+public:
+	typedef AudioSynthWavetable::instrument_data instrument_data;
+	typedef AudioSynthWavetable::sample_data sample_data;
+
+	AudioSynthWavetablePoly(void);
+
+	/**
+	 * @brief Set the instrument for a MIDI channel, 1 to 16.
+	 * Notes already playing on the channel continue with their old samples.
+	 */
+	void setInstrument(int channel, const instrument_data &instrument);
+	/**
+	 * @brief Start a note.  A note already playing on the same channel and
+	 * note is restarted, otherwise a free voice is used, or if none is free,
+	 * the quietest releasing voice or else the oldest voice is taken.
+	 * @param velocity 1 to 127, or 0 for noteOff
+	 */
+	void noteOn(int channel, int note, int velocity);
+	void noteOff(int channel, int note);
+	void allNotesOff(void);
+	// stop every voice immediately, without release
+	void allSoundOff(void);
+	// MIDI channel volume, 0 to 1.0
+	void channelVolume(int channel, float level);
+	// -1.0 is left, 0 is centre, 1.0 is right
+	void pan(int channel, float position);
+	// channel pitch bend, in semitones
+	void pitchBend(int channel, float semitones);
+	// output level, 0 to 1.0, applied to the sum of all voices
+	void amplitude(float level) {
+		if (level < 0.0f) level = 0.0f;
+		else if (level > 1.0f) level = 1.0f;
+		master_gain = level * 65536.0f;
+	}
+	// limit the polyphony, up to WAVETABLE_POLY_VOICES
+	void voices(int n) {
+		if (n < 1) n = 1;
+		else if (n > WAVETABLE_POLY_VOICES) n = WAVETABLE_POLY_VOICES;
+		__disable_irq();
+		voice_limit = n;
+		for (int i = n; i < WAVETABLE_POLY_VOICES; i++) voice[i].env_state = AudioSynthWavetable::STATE_IDLE;
+		__enable_irq();
+	}
+	// WAVETABLE_INTERPOLATION_NONE, _LINEAR or _CUBIC, as AudioSynthWavetable
+	void interpolation(int mode) {
+		if (mode < WAVETABLE_INTERPOLATION_NONE || mode > WAVETABLE_INTERPOLATION_CUBIC) return;
+		interpolation_mode = mode;
+	}
+	int activeVoices(void);
+	virtual void update(void);
+
+private:
+	struct voice_t {
+		const sample_data *sample;
+		uint32_t tone_phase;
+		uint32_t tone_incr;
+		int32_t  tone_amp;
+		uint8_t  env_state;
+		uint8_t  channel;
+		uint8_t  note;
+		int32_t  env_count;
+		int32_t  env_mult;
+		int32_t  env_incr;
+		wavetable_lfo_t lfo;
+		int32_t  lfo_incr_offset; // LFO outputs at the end of the previous block
+		int32_t  lfo_amp;
+		uint32_t age;      // noteOn count when started, for stealing
+	};
+	struct channel_t {
+		const instrument_data *instrument;
+		int32_t gain_left;   // volume and pan, 32768 = 1.0
+		int32_t gain_right;
+		float volume;
+		float position;
+		float bend;          // pitch ratio
+	};
+	void updateGains(channel_t &ch);
+	bool render(voice_t &v, int32_t *left, int32_t *right);
+	voice_t voice[WAVETABLE_POLY_VOICES];
+	channel_t chan[WAVETABLE_POLY_CHANNELS];
+	uint32_t note_count;
+	int voice_limit;
+	uint8_t interpolation_mode;
+	int32_t master_gain;
+};
@@ -0,0 +1,244 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2017, TeensyAudio PSU Team
+ *
+ * Development of this audio library was sponsored by PJRC.COM, LLC.
+ * Please support PJRC's efforts to develop open source
+ * software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// The LFOs and sample interpolation of AudioSynthWavetable, shared with
+// AudioSynthWavetablePoly and AudioSynthWavetableStream, so all three play
+// a sample the same way.  They differ only in where the sample data comes
+// from, and in what is done with the output.  Not part of the public API.
+
+#pragma once
+
+#include <Arduino.h>
+#include "synth_wavetable.h"
+#include "utility/dspinst.h"
+
+// One voice's vibrato and modulation LFOs
+struct wavetable_lfo_t {
+	uint32_t vib_count;
+	uint32_t vib_phase;
+	int32_t vib_pitch_offset_init;
+	int32_t vib_pitch_offset_scnd;
+	uint32_t mod_count;
+	int32_t mod_phase;
+	int32_t mod_pitch_offset_init;
+	int32_t mod_pitch_offset_scnd;
+};
+
+// Advance both LFOs by one audio block, giving the pitch offset and the
+// amplitude at the end of the block.  The phase and delay of each LFO still
+// advance in LFO_PERIOD steps, so their timing matches the SoundFont
+// decoder's values.
+//
+// Also note that the vibrato/tremolo for the two LFO are defined in the
+// SoundFont spec to be a cents (vibrato) or centibel (tremolo) deviation
+// oscillating with a triangle wave at a given frequency; the following
+// implementation gets the critical points of those oscillations correct,
+// but linearly interpolates the *frequency* and *amplitude* range between
+// those points, which technically results in a "bowing" of the triangle
+// wave curve relative to what it should be (although this typically isn't
+// audible).
+template <class S>
+static inline void wavetable_lfo(const S *s, wavetable_lfo_t &lfo, int32_t tone_amp,
+	int32_t &tone_incr_offset, int32_t &mod_amp)
+{
+	const uint32_t lfo_steps = AUDIO_BLOCK_SAMPLES / (int)AudioSynthWavetable::LFO_PERIOD;
+	// stays 0 if still in vibrato/modulation delay
+	tone_incr_offset = 0;
+	// stays at tone_amp if modulation in delay
+	mod_amp = tone_amp;
+	// an LFO runs for the steps where its count has passed its delay
+	uint32_t active = lfo.vib_count + lfo_steps > s->VIBRATO_DELAY + 1 ? lfo.vib_count + lfo_steps - s->VIBRATO_DELAY - 1 : 0;
+	lfo.vib_count += lfo_steps;
+	if (active) {
+		lfo.vib_phase += s->VIBRATO_INCREMENT * (active < lfo_steps ? active : lfo_steps);
+		// convert uint32_t phase value to int32_t triangle wave value
+		// TRIANGLE_INITIAL_PHASE (0xC0000000) and 0x40000000 -> 0, 0 -> INT32_MAX/2, 0x80000000 -> INT32_MIN/2
+		int32_t vib_scale = lfo.vib_phase & 0x80000000 ? 0x40000000 + lfo.vib_phase : 0x3FFFFFFF - lfo.vib_phase;
+		// select a vibrato pitch offset based on sign of scale; note that the values "init" and "scnd" values
+		// produced by the decoder script will either both be negative, or both be positive; this allows the
+		// scalar to either start with either a downward (negative offset) or upward (positive) pitch oscillation
+		int32_t vib_pitch_offset = vib_scale >= 0 ? lfo.vib_pitch_offset_init : lfo.vib_pitch_offset_scnd;
+		// scale the offset and accumulate into offset
+		// note the offset value is already preshifted by << 2 to account for this func shifting >> 32
+		tone_incr_offset = multiply_accumulate_32x32_rshift32_rounded(tone_incr_offset, vib_scale, vib_pitch_offset);
+	}
+	active = lfo.mod_count + lfo_steps > s->MODULATION_DELAY + 1 ? lfo.mod_count + lfo_steps - s->MODULATION_DELAY - 1 : 0;
+	lfo.mod_count += lfo_steps;
+	if (active) {
+		// pitch LFO component is same as above, but we'll also use the scale value for tremolo below
+		lfo.mod_phase += s->MODULATION_INCREMENT * (active < lfo_steps ? active : lfo_steps);
+		int32_t mod_scale = lfo.mod_phase & 0x80000000 ? 0x40000000 + lfo.mod_phase : 0x3FFFFFFF - lfo.mod_phase;
+		int32_t mod_pitch_offset = mod_scale >= 0 ? lfo.mod_pitch_offset_init : lfo.mod_pitch_offset_scnd;
+		tone_incr_offset = multiply_accumulate_32x32_rshift32_rounded(tone_incr_offset, mod_scale, mod_pitch_offset);
+
+		// similar to pitch, sign of init and scnd are either both + or - to allow correct triangle direction
+		int32_t mod_amp_offset = (mod_scale >= 0 ? s->MODULATION_AMPLITUDE_INITIAL_GAIN : s->MODULATION_AMPLITUDE_SECOND_GAIN);
+		// here we scale the amp offset which, similar to the pitch offset, is already pre-shifted by << 2
+		mod_scale = multiply_32x32_rshift32(mod_scale, mod_amp_offset);
+		// the resulting scalar is then used to scale mod_map (possibly resulting in a negative) and add that back into mod_amp
+		mod_amp = signed_multiply_accumulate_32x16b(mod_amp, mod_scale, mod_amp);
+	}
+}
+
+// Everything the interpolation loop needs, so the compiler keeps it in
+// registers
+struct wavetable_render_t {
+	uint32_t tone_phase;
+	int32_t tone_incr;      // including the pitch LFOs
+	int32_t tone_incr_step; // change in tone_incr per sample
+	int32_t amp;            // 8 fractional bits, including the tremolo
+	int32_t amp_step;
+	uint32_t limit;         // end of the loop, or of the sample
+	uint32_t loop_length;   // or 0 if the sample doesn't loop
+	uint32_t end;           // last index before the loop repeats, or the last sample
+	uint32_t wrap;          // loop length in samples, or 0 if the sample doesn't loop
+	int index_bits;
+};
+
+// Set up a block's ramps from the LFO outputs at the end of the previous
+// block (incr_start, amp_start) to those at the end of this one
+template <class S>
+static inline void wavetable_render_setup(wavetable_render_t &r, const S *s,
+	uint32_t tone_phase, uint32_t tone_incr, int32_t incr_start, int32_t incr_end,
+	int32_t amp_start, int32_t amp_end)
+{
+	const int shift = 32 - s->INDEX_BITS;
+	r.tone_phase = tone_phase;
+	r.tone_incr = tone_incr + incr_start;
+	r.tone_incr_step = (incr_end - incr_start) / AUDIO_BLOCK_SAMPLES;
+	r.amp = amp_start << 8;
+	r.amp_step = ((amp_end - amp_start) << 8) / AUDIO_BLOCK_SAMPLES;
+	r.index_bits = s->INDEX_BITS;
+	if (s->LOOP) {
+		r.limit = s->LOOP_PHASE_END;
+		r.loop_length = s->LOOP_PHASE_LENGTH;
+		r.end = (s->LOOP_PHASE_END >> shift) - 1;
+		r.wrap = (s->LOOP_PHASE_END >> shift) - ((s->LOOP_PHASE_END - s->LOOP_PHASE_LENGTH) >> shift);
+	} else {
+		r.limit = s->MAX_PHASE;
+		r.loop_length = 0;
+		r.end = s->MAX_PHASE >> shift;
+		r.wrap = 0;
+	}
+}
+
+// Sample data in one array, as made by the SoundFont decoder.  A reader
+// gives one sample, or two adjacent samples packed with the first in the
+// low half.
+struct wavetable_reader_t {
+	const int16_t *sample;
+	int32_t operator[](uint32_t index) const { return sample[index]; }
+	uint32_t pair(uint32_t index) const { return *((uint32_t *)(sample + index)); }
+};
+
+// Fill 'out' with up to AUDIO_BLOCK_SAMPLES samples, returning fewer if a
+// sample without a loop ends.  The mode is a template parameter, so each
+// interpolation gets its own loop, without testing the mode per sample.
+template <int mode, class R>
+static inline int wavetable_interpolate(int16_t *out, wavetable_render_t &r, const R &sample)
+{
+	uint32_t tone_phase = r.tone_phase;
+	int32_t tone_incr = r.tone_incr;
+	const int32_t tone_incr_step = r.tone_incr_step;
+	int32_t amp = r.amp;
+	const int32_t amp_step = r.amp_step;
+	const uint32_t limit = r.limit;
+	const uint32_t loop_length = r.loop_length;
+	const uint32_t end = r.end;
+	const uint32_t wrap = r.wrap;
+	const int index_bits = r.index_bits;
+	const int shift = 32 - index_bits;
+	int n;
+
+	for (n=0; n < AUDIO_BLOCK_SAMPLES; n++) {
+		uint32_t index = tone_phase >> shift;
+		int32_t val;
+		if (mode == WAVETABLE_INTERPOLATION_NONE) {
+			val = sample[index];
+		} else if (mode == WAVETABLE_INTERPOLATION_LINEAR) {
+			uint32_t tmp = sample.pair(index);
+			// the 16 bits after the index are the distance between the samples
+			uint32_t phase_scale = (tone_phase << index_bits) >> 16;
+			val = signed_multiply_32x16t(phase_scale, tmp);
+			val = signed_multiply_accumulate_32x16b(val, 0xFFFF - phase_scale, tmp);
+		} else {
+			// 4 point, 3rd order Hermite (Catmull-Rom).  With t from 0 to 1,
+			// y = x0 + t*(c1 + t*(c2 + t*c3)).  signed_multiply_32x16b()
+			// gives t*v/2 with t in 15 bits, so the coefficients are doubled.
+			// Past the end of a loop, the points come from its start.
+			uint32_t i1 = index + 1, i2 = index + 2;
+			if (i2 > end) {
+				if (wrap) {
+					i2 -= wrap;
+					if (i1 > end) i1 -= wrap;
+				} else {
+					i2 = end;
+					if (i1 > end) i1 = end;
+				}
+			}
+			int32_t xm1 = sample[index > 0 ? index - 1 : 0];
+			int32_t x0 = sample[index];
+			int32_t x1 = sample[i1];
+			int32_t x2 = sample[i2];
+			uint32_t t = (tone_phase << index_bits) >> 17;
+			int32_t c1 = x1 - xm1;
+			int32_t c2 = 2 * xm1 - 5 * x0 + 4 * x1 - x2;
+			int32_t c3 = (x2 - xm1) + 3 * (x0 - x1);
+			val = signed_multiply_32x16b(c3, t);
+			val = signed_multiply_32x16b(c2 + 2 * val, t);
+			val = signed_multiply_32x16b(c1 + 2 * val, t);
+			val = saturate16(x0 + val);
+		}
+		out[n] = signed_multiply_32x16b(amp >> 8, val);
+		amp += amp_step;
+
+		tone_phase += tone_incr;
+		tone_incr += tone_incr_step;
+		if (tone_phase >= limit) {
+			// move phase back if a looped sample has overstepped its loop
+			if (loop_length == 0) {
+				n++;
+				break;
+			}
+			tone_phase -= loop_length;
+		}
+	}
+	r.tone_phase = tone_phase;
+	return n;
+}
+
+template <class R>
+static inline int wavetable_render(int mode, int16_t *out, wavetable_render_t &r, const R &sample)
+{
+	switch (mode) {
+	case WAVETABLE_INTERPOLATION_NONE:
+		return wavetable_interpolate<WAVETABLE_INTERPOLATION_NONE>(out, r, sample);
+	case WAVETABLE_INTERPOLATION_CUBIC:
+		return wavetable_interpolate<WAVETABLE_INTERPOLATION_CUBIC>(out, r, sample);
+	default:
+		return wavetable_interpolate<WAVETABLE_INTERPOLATION_LINEAR>(out, r, sample);
+	}
+}
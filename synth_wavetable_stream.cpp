@@ -0,0 +1,487 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Arduino.h>
+#include "synth_wavetable_stream.h"
+#include "spi_interrupt.h"
+#include "utility/dspinst.h"
+
+#define STATE_IDLE    AudioSynthWavetable::STATE_IDLE
+#define STATE_DELAY   AudioSynthWavetable::STATE_DELAY
+#define STATE_ATTACK  AudioSynthWavetable::STATE_ATTACK
+#define STATE_HOLD    AudioSynthWavetable::STATE_HOLD
+#define STATE_DECAY   AudioSynthWavetable::STATE_DECAY
+#define STATE_SUSTAIN AudioSynthWavetable::STATE_SUSTAIN
+#define STATE_RELEASE AudioSynthWavetable::STATE_RELEASE
+
+static const int32_t UNITY_GAIN = AudioSynthWavetable::UNITY_GAIN;
+static const int ENVELOPE_PERIOD = AudioSynthWavetable::ENVELOPE_PERIOD;
+
+#define BUFFER_MASK (WAVETABLE_STREAM_BUFFER - 1)
+
+// File format, written by extras/wavetable2stream, all little endian:
+//   16 byte header: "WTS1", sample count, bytes of preloaded data, 0
+//   note ranges, one byte per sample, padded to a multiple of 4
+//   one 128 byte record per sample, 32 words in the order of sample_data
+//   the preloaded attack and loop data of every sample
+//   the streamed data of each sample, each starting on a 512 byte boundary
+#define HEADER_SIZE  16
+#define RECORD_SIZE  128
+
+static uint32_t get32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static float getfloat(const uint8_t *p)
+{
+	uint32_t n = get32(p);
+	float f;
+	memcpy(&f, &n, 4);
+	return f;
+}
+
+bool AudioWavetableStreamInstrument::loadSD(const char *name, void *memory, uint32_t size)
+{
+	samples = NULL;
+	required = 0;
+	__disable_irq();
+	File file = SD.open(name);
+	__enable_irq();
+	if (!file) return false;
+	bool ok = load(file, memory, size);
+	file.close();
+	if (!ok) return false;
+	filename = name;
+	sd = true;
+	return true;
+}
+
+bool AudioWavetableStreamInstrument::loadSerialFlash(const char *name, void *memory, uint32_t size)
+{
+	samples = NULL;
+	required = 0;
+	SerialFlashFile file = SerialFlash.open(name);
+	if (!file) return false;
+	bool ok = load(file, memory, size);
+	file.close();
+	if (!ok) return false;
+	filename = name;
+	sd = false;
+	return true;
+}
+
+template <class T>
+bool AudioWavetableStreamInstrument::load(T &file, void *memory, uint32_t size)
+{
+	uint8_t rec[RECORD_SIZE];
+
+	if (file.read(rec, HEADER_SIZE) != HEADER_SIZE) return false;
+	if (memcmp(rec, "WTS1", 4) != 0) return false;
+	uint32_t count = get32(rec + 4);
+	uint32_t preload = get32(rec + 8);
+	if (count < 1 || count > 128 || (preload & 3)) return false;
+	// note ranges padded to 4 in the file, and to 8 in memory
+	uint32_t ranges_size = (count + 7) & ~7;
+	required = ranges_size + count * sizeof(sample_data) + preload;
+	if (memory == NULL || size < required) return false;
+	uint8_t *ranges = (uint8_t *)memory;
+	sample_data *list = (sample_data *)(ranges + ranges_size);
+	int16_t *data = (int16_t *)(list + count);
+
+	uint32_t n = (count + 3) & ~3;
+	if ((uint32_t)file.read(ranges, n) != n) return false;
+	for (uint32_t i=0; i < count; i++) {
+		if (file.read(rec, RECORD_SIZE) != RECORD_SIZE) return false;
+		sample_data *s = list + i;
+		s->LOOP = get32(rec) & 1;
+		s->INDEX_BITS = get32(rec + 4);
+		s->PER_HERTZ_PHASE_INCREMENT = getfloat(rec + 8);
+		s->MAX_PHASE = get32(rec + 12);
+		s->LOOP_PHASE_END = get32(rec + 16);
+		s->LOOP_PHASE_LENGTH = get32(rec + 20);
+		s->INITIAL_ATTENUATION_SCALAR = get32(rec + 24);
+		s->DELAY_COUNT = get32(rec + 28);
+		s->ATTACK_COUNT = get32(rec + 32);
+		s->HOLD_COUNT = get32(rec + 36);
+		s->DECAY_COUNT = get32(rec + 40);
+		s->RELEASE_COUNT = get32(rec + 44);
+		s->SUSTAIN_MULT = get32(rec + 48);
+		s->VIBRATO_DELAY = get32(rec + 52);
+		s->VIBRATO_INCREMENT = get32(rec + 56);
+		s->VIBRATO_PITCH_COEFFICIENT_INITIAL = getfloat(rec + 60);
+		s->VIBRATO_PITCH_COEFFICIENT_SECOND = getfloat(rec + 64);
+		s->MODULATION_DELAY = get32(rec + 68);
+		s->MODULATION_INCREMENT = get32(rec + 72);
+		s->MODULATION_PITCH_COEFFICIENT_INITIAL = getfloat(rec + 76);
+		s->MODULATION_PITCH_COEFFICIENT_SECOND = getfloat(rec + 80);
+		s->MODULATION_AMPLITUDE_INITIAL_GAIN = get32(rec + 84);
+		s->MODULATION_AMPLITUDE_SECOND_GAIN = get32(rec + 88);
+		s->ATTACK_LENGTH = get32(rec + 92);
+		s->LOOP_START = get32(rec + 96);
+		uint32_t attack_offset = get32(rec + 100);
+		uint32_t loop_offset = get32(rec + 104);
+		s->BODY_OFFSET = get32(rec + 108);
+		s->BODY_LENGTH = get32(rec + 112);
+		if (s->INDEX_BITS < 1 || s->INDEX_BITS > 31) return false;
+		if ((attack_offset & 1) || attack_offset > preload
+		  || s->ATTACK_LENGTH >= (preload - attack_offset) / 2) return false;
+		s->attack = data + attack_offset / 2;
+		if (s->LOOP) {
+			uint32_t loop_length = (s->LOOP_PHASE_END >> (32 - s->INDEX_BITS)) - s->LOOP_START;
+			if ((loop_offset & 1) || loop_offset > preload
+			  || loop_length >= (preload - loop_offset) / 2) return false;
+			s->loop = data + loop_offset / 2;
+		} else {
+			// never reached, so a sample without a loop needs no test
+			s->LOOP_START = 0xFFFFFFFF;
+			s->loop = NULL;
+		}
+	}
+	if ((uint32_t)file.read(data, preload) != preload) return false;
+	sample_count = count;
+	note_ranges = ranges;
+	samples = list;
+	return true;
+}
+
+
+void AudioSynthWavetableStream::setInstrument(AudioWavetableStreamInstrument &instr)
+{
+	__disable_irq();
+	instrument = NULL;
+	current_sample = NULL;
+	env_state = STATE_IDLE;
+	state_change = true;
+	__enable_irq();
+	closeFile();
+	if (!instr.isLoaded()) return;
+	if (instr.sd) {
+#if defined(HAS_KINETIS_SDHC)
+		if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStartUsingSPI();
+#else
+		AudioStartUsingSPI();
+#endif
+		__disable_irq();
+		sdfile = SD.open(instr.filename);
+		__enable_irq();
+		if (!sdfile) {
+#if defined(HAS_KINETIS_SDHC)
+			if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+#else
+			AudioStopUsingSPI();
+#endif
+			return;
+		}
+	} else {
+		AudioStartUsingSPI();
+		flashfile = SerialFlash.open(instr.filename);
+		if (!flashfile) {
+			AudioStopUsingSPI();
+			return;
+		}
+	}
+	file_open = true;
+	file_sd = instr.sd;
+	file_position = 0xFFFFFFFF;
+	__disable_irq();
+	instrument = &instr;
+	__enable_irq();
+}
+
+void AudioSynthWavetableStream::closeFile(void)
+{
+	if (!file_open) return;
+	file_open = false;
+	if (file_sd) {
+		sdfile.close();
+#if defined(HAS_KINETIS_SDHC)
+		if (!(SIM_SCGC3 & SIM_SCGC3_SDHC)) AudioStopUsingSPI();
+#else
+		AudioStopUsingSPI();
+#endif
+	} else {
+		flashfile.close();
+		AudioStopUsingSPI();
+	}
+}
+
+void AudioSynthWavetableStream::stop(void)
+{
+	__disable_irq();
+	if (env_state != STATE_IDLE) {
+		env_state = STATE_RELEASE;
+		env_count = current_sample ? current_sample->RELEASE_COUNT : 1;
+		if (env_count == 0) env_count = 1;
+		env_incr = -(env_mult) / (env_count * ENVELOPE_PERIOD);
+	}
+	__enable_irq();
+}
+
+void AudioSynthWavetableStream::playFrequency(float freq, int amp)
+{
+	setState(AudioSynthWavetable::freqToNote(freq), amp, freq);
+}
+
+void AudioSynthWavetableStream::playNote(int note, int amp)
+{
+	setState(note, amp, AudioSynthWavetable::noteToFreq(note));
+}
+
+void AudioSynthWavetableStream::setState(int note, int amp, float freq)
+{
+	__disable_irq();
+	env_state = STATE_IDLE;
+	current_sample = NULL;
+	if (instrument == NULL) {
+		__enable_irq();
+		return;
+	}
+	int i, last = instrument->sample_count - 1;
+	for (i=0; i < last && note > instrument->note_ranges[i]; i++) ;
+	current_sample = &instrument->samples[i];
+	setFrequency(freq);
+	lfo.vib_count = lfo.mod_count = tone_phase = env_incr = env_mult = 0;
+	lfo.vib_phase = lfo.mod_phase = AudioSynthWavetable::TRIANGLE_INITIAL_PHASE;
+	env_count = current_sample->DELAY_COUNT;
+	tone_amp = amp * (UINT16_MAX / 127);
+	tone_amp = current_sample->INITIAL_ATTENUATION_SCALAR * tone_amp >> 16;
+	lfo_incr_offset = 0;
+	lfo_amp = tone_amp;
+	// the attack plays from memory while the ring fills
+	buffer_fill = 0;
+	env_state = STATE_DELAY;
+	state_change = true;
+	__enable_irq();
+}
+
+void AudioSynthWavetableStream::setFrequency(float freq)
+{
+	if (current_sample == NULL) return;
+	float tone_incr_temp = freq * current_sample->PER_HERTZ_PHASE_INCREMENT;
+	tone_incr = tone_incr_temp;
+	lfo.vib_pitch_offset_init = tone_incr_temp * current_sample->VIBRATO_PITCH_COEFFICIENT_INITIAL;
+	lfo.vib_pitch_offset_scnd = tone_incr_temp * current_sample->VIBRATO_PITCH_COEFFICIENT_SECOND;
+	lfo.mod_pitch_offset_init = tone_incr_temp * current_sample->MODULATION_PITCH_COEFFICIENT_INITIAL;
+	lfo.mod_pitch_offset_scnd = tone_incr_temp * current_sample->MODULATION_PITCH_COEFFICIENT_SECOND;
+}
+
+// read one sector of a sample's streamed data, seeking only when the
+// file was last used for a different place
+void AudioSynthWavetableStream::readChunk(uint32_t offset, int16_t *dest)
+{
+	uint32_t n;
+
+	if (file_sd) {
+		if (file_position != offset) sdfile.seek(offset);
+		n = sdfile.read(dest, WAVETABLE_STREAM_CHUNK * 2);
+	} else {
+		if (file_position != offset) flashfile.seek(offset);
+		n = flashfile.read(dest, WAVETABLE_STREAM_CHUNK * 2);
+	}
+	if (n > WAVETABLE_STREAM_CHUNK * 2) n = 0;
+	file_position = offset + n;
+	if (n < WAVETABLE_STREAM_CHUNK * 2) {
+		memset((uint8_t *)dest + n, 0, WAVETABLE_STREAM_CHUNK * 2 - n);
+		file_position = 0xFFFFFFFF;
+	}
+}
+
+// Fill the ring up to 'needed' samples of the body, which this block may
+// reach, plus one more sector while there is room.  'playing' is the
+// earliest body sample still in use.
+void AudioSynthWavetableStream::readAhead(const sample_data *s, uint32_t needed, uint32_t playing)
+{
+	bool extra = true;
+
+	while (buffer_fill < s->BODY_LENGTH
+	  && buffer_fill + WAVETABLE_STREAM_CHUNK <= playing + WAVETABLE_STREAM_BUFFER) {
+		if (buffer_fill >= needed) {
+			if (!extra) break;
+			extra = false;
+		}
+		readChunk(s->BODY_OFFSET + buffer_fill * 2, buffer + (buffer_fill & BUFFER_MASK));
+		buffer_fill += WAVETABLE_STREAM_CHUNK;
+	}
+}
+
+// Samples from the preloaded attack, the streamed ring, or the preloaded
+// loop, read like the original sample data
+struct stream_reader_t {
+	const AudioWavetableStreamInstrument::sample_data *s;
+	const int16_t *buffer;
+	int32_t operator[](uint32_t index) const {
+		if (index < s->ATTACK_LENGTH) return s->attack[index];
+		if (index >= s->LOOP_START) return s->loop[index - s->LOOP_START];
+		return buffer[(index - s->ATTACK_LENGTH) & BUFFER_MASK];
+	}
+	// two adjacent samples, packed with the first in the low half
+	uint32_t pair(uint32_t index) const {
+		if (index < s->ATTACK_LENGTH) return *((uint32_t *)(s->attack + index));
+		if (index >= s->LOOP_START) return *((uint32_t *)(s->loop + (index - s->LOOP_START)));
+		index = (index - s->ATTACK_LENGTH) & BUFFER_MASK;
+		if (index < BUFFER_MASK) return *((uint32_t *)(buffer + index));
+		return (uint16_t)buffer[BUFFER_MASK] | ((uint32_t)(uint16_t)buffer[0] << 16);
+	}
+};
+
+void AudioSynthWavetableStream::update(void)
+{
+#if defined(KINETISK) || defined(__IMXRT1062__)
+	const sample_data *s = current_sample;
+	if (env_state == STATE_IDLE || s == NULL ||
+	   (s->LOOP == false && tone_phase >= s->MAX_PHASE)) {
+		env_state = STATE_IDLE;
+		return;
+	}
+	// else locally copy object state and continue
+	this->state_change = false;
+
+	uint32_t tone_phase = this->tone_phase;
+	uint32_t tone_incr = this->tone_incr;
+	uint16_t tone_amp = this->tone_amp;
+
+	AudioSynthWavetable::envelopeStateEnum env_state = this->env_state;
+	int32_t env_count = this->env_count;
+	int32_t env_mult = this->env_mult;
+	int32_t env_incr = this->env_incr;
+	wavetable_lfo_t lfo = this->lfo;
+
+	audio_block_t *block = allocate();
+	if (block == NULL) return;
+
+	const int shift = 32 - s->INDEX_BITS;
+	uint32_t index = tone_phase >> shift;
+	if (file_open && index < s->ATTACK_LENGTH + s->BODY_LENGTH) {
+		// the furthest this block can reach, with both LFOs at their peaks
+		uint64_t incr = (uint64_t)tone_incr + 2
+			+ ((uint32_t)abs(lfo.vib_pitch_offset_init) >> 2) + ((uint32_t)abs(lfo.vib_pitch_offset_scnd) >> 2)
+			+ ((uint32_t)abs(lfo.mod_pitch_offset_init) >> 2) + ((uint32_t)abs(lfo.mod_pitch_offset_scnd) >> 2);
+		uint64_t reach = ((tone_phase + incr * AUDIO_BLOCK_SAMPLES) >> shift) + 2;
+		uint32_t needed = 0;
+		if (reach > s->ATTACK_LENGTH) {
+			reach -= s->ATTACK_LENGTH;
+			needed = reach < s->BODY_LENGTH ? reach : s->BODY_LENGTH;
+		}
+		// the cubic interpolation also reads the sample before the index
+		uint32_t playing = index > s->ATTACK_LENGTH ? index - s->ATTACK_LENGTH - 1 : 0;
+		readAhead(s, needed, playing);
+	}
+
+	// interpolation and LFOs, the same as AudioSynthWavetable, but reading
+	// from the preloaded attack, the streamed ring, or the preloaded loop
+	int32_t tone_incr_offset, mod_amp;
+	wavetable_lfo(s, lfo, tone_amp, tone_incr_offset, mod_amp);
+	wavetable_render_t r;
+	wavetable_render_setup(r, s, tone_phase, tone_incr,
+		lfo_incr_offset, tone_incr_offset, lfo_amp, mod_amp);
+	stream_reader_t sample = { s, buffer };
+	int16_t *data = block->data;
+	int n = wavetable_render(interpolation_mode, data, r, sample);
+	tone_phase = r.tone_phase;
+	// fill with 0s if non-looping sample that ended prematurely
+	if (n < AUDIO_BLOCK_SAMPLES) {
+		env_state = STATE_IDLE;
+		env_count = 0;
+		while (n < AUDIO_BLOCK_SAMPLES) data[n++] = 0;
+	}
+
+	uint32_t *p, *end;
+	uint32_t tmp1, tmp2;
+
+	// volume envelope, the same as AudioSynthWavetable
+	p = (uint32_t *)block->data;
+	end = p + AUDIO_BLOCK_SAMPLES / 2;
+	while (p < end) {
+		if (env_count <= 0) switch (env_state) {
+		case STATE_DELAY:
+			env_state = STATE_ATTACK;
+			env_count = s->ATTACK_COUNT;
+			env_incr = env_count > 0 ? UNITY_GAIN / (env_count * ENVELOPE_PERIOD) : 0;
+			continue;
+		case STATE_ATTACK:
+			env_mult = UNITY_GAIN;
+			env_state = STATE_HOLD;
+			env_count = s->HOLD_COUNT;
+			env_incr = 0;
+			continue;
+		case STATE_HOLD:
+			env_state = STATE_DECAY;
+			env_count = s->DECAY_COUNT;
+			env_incr = env_count > 0 ? (-s->SUSTAIN_MULT) / (env_count * ENVELOPE_PERIOD) : 0;
+			continue;
+		case STATE_DECAY:
+			env_mult = UNITY_GAIN - s->SUSTAIN_MULT;
+			env_state = env_mult < UNITY_GAIN / UINT16_MAX ? STATE_RELEASE : STATE_SUSTAIN;
+			env_incr = 0;
+			continue;
+		case STATE_SUSTAIN:
+			env_count = INT32_MAX;
+			continue;
+		case STATE_RELEASE:
+			env_state = STATE_IDLE;
+			for (; p < end; ++p) *p = 0;
+			continue;
+		default:
+			p = end;
+			continue;
+		}
+
+		for (int i=0; i < ENVELOPE_PERIOD / 2; i++) {
+			env_mult += env_incr;
+			tmp1 = signed_multiply_32x16b(env_mult, p[i]) << 1;
+			env_mult += env_incr;
+			tmp2 = signed_multiply_32x16t(env_mult, p[i]) << 1;
+			p[i] = pack_16t_16t(tmp2, tmp1);
+		}
+		p += ENVELOPE_PERIOD / 2;
+		env_count--;
+	}
+
+	// copy state back, unless there was a state change
+	if (this->state_change == false) {
+		this->tone_phase = tone_phase;
+		this->lfo_incr_offset = tone_incr_offset;
+		this->lfo_amp = mod_amp;
+		this->env_state = env_state;
+		this->env_count = env_count;
+		this->env_mult = env_mult;
+		this->env_incr = env_incr;
+		if (env_state != STATE_IDLE) {
+			this->lfo.vib_count = lfo.vib_count;
+			this->lfo.vib_phase = lfo.vib_phase;
+			this->lfo.mod_count = lfo.mod_count;
+			this->lfo.mod_phase = lfo.mod_phase;
+		} else {
+			this->lfo.vib_count = this->lfo.mod_count = 0;
+			this->lfo.vib_phase = this->lfo.mod_phase = AudioSynthWavetable::TRIANGLE_INITIAL_PHASE;
+		}
+	}
+
+	transmit(block);
+	release(block);
+#endif
+}
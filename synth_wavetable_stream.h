@@ -0,0 +1,186 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2026, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Arduino.h>     // github.com/PaulStoffregen/cores/blob/master/teensy4/Arduino.h
+#include <AudioStream.h> // github.com/PaulStoffregen/cores/blob/master/teensy4/AudioStream.h
+#include <SD.h>          // github.com/PaulStoffregen/SD/blob/Juse_Use_SdFat/src/SD.h
+#include <SerialFlash.h> // github.com/PaulStoffregen/SerialFlash/blob/master/SerialFlash.h
+#include "synth_wavetable.h"
+#include "synth_wavetable_render.h"
+
+// Streaming wavetable instruments, for sample sets too large for program
+// memory.  The extras/wavetable2stream converter turns the output of the
+// SoundFont decoder into a single file for SD or SerialFlash.  Loading the
+// file keeps only the start (attack) and loop of each sample in RAM or
+// EXTMEM.  The rest of each sample is read from the file while the note
+// plays, one 512 byte sector at a time.
+
+// Samples of read-ahead per voice, a power of 2.  The pitch may be raised
+// until one audio block uses all but WAVETABLE_STREAM_CHUNK of these,
+// about 2.5 octaves with the default.
+#ifndef WAVETABLE_STREAM_BUFFER
+#define WAVETABLE_STREAM_BUFFER 1024
+#endif
+// Samples per read.  Each sample's streamed data begins on a sector
+// boundary, so every read is a single whole sector.
+#define WAVETABLE_STREAM_CHUNK 256
+
+class AudioWavetableStreamInstrument
+{
+public:
+	struct sample_data {
+		// the same as AudioSynthWavetable::sample_data
+		bool LOOP;
+		int INDEX_BITS;
+		float PER_HERTZ_PHASE_INCREMENT;
+		uint32_t MAX_PHASE;
+		uint32_t LOOP_PHASE_END;
+		uint32_t LOOP_PHASE_LENGTH;
+		uint16_t INITIAL_ATTENUATION_SCALAR;
+		uint32_t DELAY_COUNT;
+		uint32_t ATTACK_COUNT;
+		uint32_t HOLD_COUNT;
+		uint32_t DECAY_COUNT;
+		uint32_t RELEASE_COUNT;
+		int32_t SUSTAIN_MULT;
+		uint32_t VIBRATO_DELAY;
+		uint32_t VIBRATO_INCREMENT;
+		float VIBRATO_PITCH_COEFFICIENT_INITIAL;
+		float VIBRATO_PITCH_COEFFICIENT_SECOND;
+		uint32_t MODULATION_DELAY;
+		uint32_t MODULATION_INCREMENT;
+		float MODULATION_PITCH_COEFFICIENT_INITIAL;
+		float MODULATION_PITCH_COEFFICIENT_SECOND;
+		int32_t MODULATION_AMPLITUDE_INITIAL_GAIN;
+		int32_t MODULATION_AMPLITUDE_SECOND_GAIN;
+
+		// preloaded: samples 0 to ATTACK_LENGTH, and LOOP_START to the
+		// end of the loop, each including its last sample
+		const int16_t *attack;
+		const int16_t *loop;
+		uint32_t ATTACK_LENGTH;
+		uint32_t LOOP_START;
+		// streamed: BODY_LENGTH samples from ATTACK_LENGTH onward,
+		// starting at byte BODY_OFFSET of the file
+		uint32_t BODY_OFFSET;
+		uint32_t BODY_LENGTH;
+	};
+
+	AudioWavetableStreamInstrument(void) : filename(NULL), sample_count(0),
+		note_ranges(NULL), samples(NULL), required(0) {}
+	/**
+	 * @brief Load an instrument from the SD card, or from SerialFlash.
+	 * The file stays open while notes play, so the filename must remain
+	 * valid as long as the instrument is used.
+	 * @param memory RAM or EXTMEM for the preloaded data, which must
+	 * remain allocated as long as the instrument is used
+	 * @param size bytes of memory; the converter prints the size needed
+	 * @return false if the file cannot be read, or memory is too small
+	 */
+	bool loadSD(const char *filename, void *memory, uint32_t size);
+	bool loadSerialFlash(const char *filename, void *memory, uint32_t size);
+	// bytes of memory needed by the last file loaded, even if it failed
+	uint32_t memoryRequired(void) { return required; }
+	bool isLoaded(void) { return samples != NULL; }
+private:
+	template <class T> bool load(T &file, void *memory, uint32_t size);
+	const char *filename;
+	bool sd;
+	uint8_t sample_count;
+	const uint8_t *note_ranges;
+	const sample_data *samples;
+	uint32_t required;
+	friend class AudioSynthWavetableStream;
+};
+
+class AudioSynthWavetableStream : public AudioStream
+{
+public:
+	typedef AudioWavetableStreamInstrument::sample_data sample_data;
+
+	AudioSynthWavetableStream(void) : AudioStream(0, NULL) {}
+
+	/**
+	 * @brief Set the instrument to play, and open its file for streaming.
+	 * Call this from setup() or loop(), not from an interrupt.
+	 */
+	void setInstrument(AudioWavetableStreamInstrument &instrument);
+	// 0 to 1.0, the same as AudioSynthWavetable
+	void amplitude(float v) {
+		v = (v < 0.0f) ? 0.0f : (v > 1.0f) ? 1.0f : v;
+		tone_amp = (uint16_t)(UINT16_MAX*v);
+	}
+	// WAVETABLE_INTERPOLATION_NONE, _LINEAR or _CUBIC, as AudioSynthWavetable
+	void interpolation(int mode) {
+		if (mode < WAVETABLE_INTERPOLATION_NONE || mode > WAVETABLE_INTERPOLATION_CUBIC) return;
+		interpolation_mode = mode;
+	}
+	void stop(void);
+	void playFrequency(float freq, int amp = AudioSynthWavetable::DEFAULT_AMPLITUDE);
+	void playNote(int note, int amp = AudioSynthWavetable::DEFAULT_AMPLITUDE);
+	bool isPlaying(void) { return env_state != AudioSynthWavetable::STATE_IDLE; }
+	void setFrequency(float freq);
+	virtual void update(void);
+
+private:
+	void setState(int note, int amp, float freq);
+	void closeFile(void);
+	void readAhead(const sample_data *s, uint32_t needed, uint32_t playing);
+	void readChunk(uint32_t offset, int16_t *dest);
+
+	volatile bool state_change = false;
+	AudioWavetableStreamInstrument *instrument = NULL;
+	const sample_data *current_sample = NULL;
+	File sdfile;
+	SerialFlashFile flashfile;
+	bool file_open = false;
+	bool file_sd = false;
+	uint32_t file_position = 0;
+
+	// streamed samples are kept in a ring, at (index - ATTACK_LENGTH)
+	int16_t buffer[WAVETABLE_STREAM_BUFFER];
+	uint32_t buffer_fill = 0; // samples of the body read so far
+
+	//sample output state
+	uint32_t tone_phase = 0;
+	uint32_t tone_incr = 0;
+	uint16_t tone_amp = 0;
+
+	//volume environment state
+	volatile AudioSynthWavetable::envelopeStateEnum env_state = AudioSynthWavetable::STATE_IDLE;
+	int32_t env_count = 0;
+	int32_t env_mult = 0;
+	int32_t env_incr = 0;
+
+	//vibrato and modulation LFO state
+	wavetable_lfo_t lfo = {0, 0, 0, 0, 0, (int32_t)AudioSynthWavetable::TRIANGLE_INITIAL_PHASE, 0, 0};
+	//LFO outputs at the end of the previous block, the start of the next ramp
+	int32_t lfo_incr_offset = 0;
+	int32_t lfo_amp = 0;
+	uint8_t interpolation_mode = WAVETABLE_INTERPOLATION_DEFAULT;
+};